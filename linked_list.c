@@ -1,871 +1,4575 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
 #include "linked_list.h"
 
 typedef struct node {
 	void *value;
-	size_t val_size;
 	struct node *next;
+#ifdef LL_DEBUG_HANDLES
+	size_t generation; // Copied into handles to the node, 0 once the node is released
+#endif
 } node;
 
+// Nodes of lists without a fixed element size also store the size of their value
+typedef struct sized_node {
+	node base;
+	size_t val_size;
+} sized_node;
+
+typedef struct node_pool {
+	size_t refs; // Amount of linked lists using the pool
+	size_t slot_size; // Bytes per node including the room for its co-allocated value, 0 if the pool is an arena
+	size_t slab_size; // Bytes carved from each slab
+	size_t slab_left; // Bytes not handed out yet from the newest slab
+	size_t reserved; // Bytes of all slabs together
+	size_t live; // Bytes of the nodes handed out and not released, the rest of reserved is unused
+	size_t allocations; // Slabs allocated
+	size_t deallocations; // Slabs given back
+	size_t outside_values; // Values of nodes from this pool that have their own allocation
+	char *bump; // Next free byte in the newest slab
+	void *slabs; // Newest slab, the first bytes of every slab point to the slab allocated before it
+	node *free_nodes; // Released nodes waiting to be reused, linked through next
+	void *(*allocate)(size_t size);
+	void (*deallocate)(void *);
+} node_pool;
+
+typedef struct string_entry {
+	size_t hash;
+	char *str;
+} string_entry;
+
+typedef struct retained_strings {
+	struct string_store *store;
+	struct retained_strings *next;
+} retained_strings;
+
+typedef struct string_store {
+	size_t refs; // Amount of linked lists and stores pointing at strings in this store
+	node_pool *bytes; // Arena the strings are carved from, each one is preceded by its length
+	string_entry *entries; // Open addressing table of interned strings, NULL if the store does not intern
+	size_t entries_used;
+	size_t capacity; // Always a power of 2
+	retained_strings *retained; // Stores of lists that were combined into a list using this store
+} string_store;
+
+// Levels above the list itself, the list is the bottom level so nodes without a tower cost nothing
+#define SKIP_LEVELS 32
+
+// Nodes the finger walks on before a lookup goes through the skip index instead
+#define FINGER_REACH 16
+
+// Index passed to the linking functions when only the neighbouring node is known, the fingers are dropped, the skip
+// index is marked out of date and a hash index is rebuilt
+#define UNKNOWN_INDEX ((size_t) -1)
+
+typedef struct skip_tower skip_tower;
+
+typedef struct skip_link {
+	skip_tower *next; // NULL after the last tower of the level
+	size_t span; // Positions from this tower to next, or to one past the last node when next is NULL
+} skip_link;
+
+// Tower of a node in the skip index, links[0] is the lowest level above the list
+struct skip_tower {
+	node *target;
+	size_t height;
+	skip_link links[];
+};
+
+typedef struct skip_index {
+	size_t levels; // Levels with at least one tower
+	int valid; // 0 after a bulk change of the list, the towers are rebuilt before the next lookup
+	unsigned long long seed; // State of the xorshift picking tower heights
+	skip_tower *header; // Tower in front of the head with SKIP_LEVELS levels, its target is NULL
+} skip_index;
+
+// The towers passed on the way to a position and the positions they are at, the header is at 0 and the head at 1
+typedef struct skip_path {
+	skip_tower *update[SKIP_LEVELS];
+	size_t rank[SKIP_LEVELS];
+} skip_path;
+
+typedef struct occurrence {
+	node *target;
+	size_t key; // Index of the node plus the head_key of the hash index, so prepending does not renumber the nodes
+	size_t stamp; // Edits of the hash index already counted in key, the later ones are replayed by current_key_ll
+} occurrence;
+
+// Node linked in or out of the middle of a list with a hash index, every node after it moved by one
+typedef struct key_edit {
+	size_t key; // Key the node got or had
+	int inserted; // 1 if the node was linked in, 0 if it was unlinked
+} key_edit;
+
+typedef struct value_group {
+	size_t hash;
+	size_t count; // Nodes holding values that compare equal, 0 if they were all removed
+	size_t capacity; // Room in occurrences, 0 if the slot was never used
+	size_t renumbered; // Occurrences given their new key so far by renumber_keys_ll
+	occurrence *occurrences; // In list order
+} value_group;
+
+typedef struct hash_index {
+	size_t (*hash)(const void *value);
+	value_group *groups; // Open addressing table
+	size_t groups_used; // Slots with a capacity, groups whose values were all removed included
+	size_t capacity; // Always a power of 2
+	size_t head_key; // Key of the head, starts in the middle of the size_t range so keys can be compared
+	int valid; // 0 while a bulk change of the list is in progress, lookups scan the list until the groups are rebuilt
+	key_edit *edits; // Edits in the middle since the keys were numbered, they are renumbered once there are too many
+	size_t edit_count;
+	size_t edit_capacity;
+} hash_index;
+
 typedef struct linked_list {
 	size_t size;
+	size_t elem_size; // Size of every value if the list was made with new_fixed_linked_list, else 0 and nodes are sized_nodes
+	int co_allocate; // 1 if each node and its value are stored in a single allocation
+	int deque; // 1 if nodes also point to the node before them, see set_deque_ll
+	int prevs_valid; // 0 after a bulk change of a deque list, the previous pointers are rebuilt when needed
+	int flipped; // 1 after an O(1) reverse_ll of a deque list, next and previous pointers swap meaning until settled
+	node_pool *pool; // Not NULL if nodes come from a slab pool or an arena, always co-allocated
+	string_store *strings; // Not NULL if the list was made with new_string_linked_list
+	ll_memory_stats memory; // Kept up to date by every function that adds, removes or moves nodes
+	size_t index_bytes; // Bytes of the skip and hash index, reported as overhead
+	skip_index *skip; // Not NULL if set_skip_index_ll turned the positional index on
+	hash_index *hash; // Not NULL if set_hash_index_ll turned the value index on
+	node *finger; // Node reached by the last positional change, NULL if a change of the list may have moved it
+	size_t finger_index;
+	size_t id; // Unique to this list, never reused even if the struct memory is
+	size_t version; // Counts the changes that moved or removed nodes other than appending, see read_finger
 	void (*printv)(void*);
 	void (*freev)(void*);
 	void *(*deep_copyv)(void * restrict destination, const void * restrict source, size_t size);
 	void *(*allocate)(size_t size);
+	void (*deallocate)(void *);
 	int (*compare)(const void * a, const void * b); // return < 0 if b > a ||| return 0 if a == b ||| return 1 if a > b. Pointers a and b point to two values/data
 	node *head;
 	node *tail;
 } linked_list;
 
+// Node the last read of a list by this thread walked to, lets get_data_ll loops go on from it without writing to the
+// list so any number of threads can read it. Only used while list_id and version still match the list
+typedef struct read_finger {
+	size_t list_id;
+	size_t version;
+	node *target;
+	size_t index;
+} read_finger;
+
+static _Thread_local read_finger read_finger_ll;
+
+static atomic_size_t list_ids_ll;
+
 linked_list *new_linked_list(void *(*allocator_p)(size_t)) {
 	void *(*allocator)(size_t) = (allocator_p == NULL) ? malloc : allocator_p;
 	linked_list *new_list = (linked_list*) allocator (sizeof(linked_list));
 	new_list->size = 0;
+	new_list->elem_size = 0;
 	new_list->printv = NULL;
 	new_list->freev = free;
 	new_list->deep_copyv = memcpy;
 	new_list->allocate = allocator;
+	new_list->deallocate = free;
 	new_list->compare = NULL;
+	new_list->co_allocate = 0;
+	new_list->deque = 0;
+	new_list->prevs_valid = 1;
+	new_list->flipped = 0;
+	new_list->pool = NULL;
+	new_list->strings = NULL;
+	memset(&new_list->memory, 0, sizeof(ll_memory_stats));
+	new_list->index_bytes = 0;
+	new_list->skip = NULL;
+	new_list->finger = NULL;
+	new_list->finger_index = 0;
+	new_list->id = atomic_fetch_add(&list_ids_ll, 1) + 1;
+	new_list->version = 0;
+	new_list->hash = NULL;
 	new_list->head = NULL;
 	new_list->tail = NULL;
 	return new_list;
 }
 
-void set_free_ll(linked_list *list, void (*free_p)(void *)) {
-	list->freev = free_p;
+linked_list *new_fixed_linked_list(size_t elem_size, void *(*allocator_p)(size_t)) {
+	linked_list *new_list = new_linked_list(allocator_p);
+	new_list->elem_size = elem_size ? elem_size : 1;
+	return new_list;
 }
 
-void set_print_ll(linked_list *list, void (*print_p)(void *)) {
-	list->printv = print_p;
-}
+// Rounds size up so any type can be stored right after it
+#define ALIGN_UP(size) ((((size) + _Alignof(max_align_t) - 1) / _Alignof(max_align_t)) * _Alignof(max_align_t))
 
-void set_deep_copy_ll(linked_list *list, void *(*deep_copy_p)(void * restrict destination, const void * restrict source, size_t size)) {
-	list->deep_copyv = deep_copy_p;
-}
+#define HEADER_SIZE(list) (((list)->elem_size ? sizeof(node) : sizeof(sized_node)) + ((list)->deque ? sizeof(node *) : 0))
 
-void set_allocater_ll(linked_list *list, void *(allocate_p)(size_t size)) {
-	list->allocate = allocate_p;
-}
+// Pointer to the node before n in a deque list, stored right after the rest of the header
+#define PREV_NODE(list, n) (*(node**) ((char*) (n) + ((list)->elem_size ? sizeof(node) : sizeof(sized_node))))
 
-void set_compare_ll(linked_list *list, int (*compare_p)(const void *a, const void *b)) {
-	list->compare = compare_p;
-}
+// Value of a co-allocated node starts here
+#define PAYLOAD_OFFSET(list) ALIGN_UP(HEADER_SIZE(list))
 
-size_t get_size_ll(linked_list *list) {
-	return list->size;
-}
+// Node after n in list order, also while the links of a deque list are flipped, for functions that only read the list
+#define NEXT_NODE(list, n) ((list)->flipped ? PREV_NODE(list, n) : (n)->next)
+
+#define VAL_SIZE(list, n) ((list)->elem_size ? (list)->elem_size : ((sized_node*) (n))->val_size)
+
+// 1 if the value of a node in a co-allocated list lives in the same block as the node
+// Values that do not fit a pool slot are allocated on their own and fail this check
+#define VALUE_IS_INLINE(list, n) ((n)->value == (char*) (n) + PAYLOAD_OFFSET(list))
+
+// Slabs start with a pointer to the previous slab, padded so nodes carved after it are aligned
+#define SLAB_HEADER ALIGN_UP(sizeof(void *))
+
+#define IS_ARENA(pool) ((pool)->slot_size == 0)
+
+// Estimated bytes an allocation of size bytes takes, a size_t of bookkeeping rounded up like malloc does
+#define HEAP_BLOCK(size) ALIGN_UP((size) + sizeof(size_t))
+
+// Key of the head of a hash index after it is built
+#define KEY_ORIGIN (((size_t) -1) / 2)
+
+// Fewest edits in the middle a hash index keeps before its keys are renumbered
+#define MIN_KEY_EDITS 64
+
+// Where add_occurrence_ll puts a node among the other occurrences of its value
+#define PLACE_LAST 0
+#define PLACE_FIRST 1
+#define PLACE_BY_KEY 2
+
+// Chunk size of the arenas made for buffer_to_linked_list and string lists
+#define DEFAULT_CHUNK_SIZE (1 << 16)
+
+// Fewest nodes parallel_merge_sort_ll gives a thread
+#define PARALLEL_SORT_MIN_CHUNK 4096
+
+// Turns the links around after an O(1) reverse_ll of a deque list, functions that follow next call it first
+static void settle_links_ll(linked_list *list) {
+	if (!list->flipped) {
+		return;
+	}
 
-void empty_ll(linked_list* list) {
 	node *curr = list->head;
 	node *next;
 	while (curr != NULL) {
-		next = curr->next;
-		list->freev(curr->value);
-		free(curr);
+		next = PREV_NODE(list, curr); // Next in list order while flipped
+		PREV_NODE(list, curr) = curr->next;
+		curr->next = next;
 		curr = next;
 	}
-	list->head = list->tail = NULL;
+	list->flipped = 0;
 }
 
-void free_linked_list(linked_list* list) {
-	empty_ll(list);
-	free(list);
-}
+// Sets the previous pointers of a deque list again after a function relinked it
+static void refresh_prevs_ll(linked_list *list) {
+	if (!list->deque || list->prevs_valid) {
+		return;
+	}
 
-int is_empty_ll(linked_list *list) {
-	if (list->head == NULL) {
-		return 1;
-	} return 0;
+	node *prev = NULL;
+	for (node *curr = list->head; curr != NULL; curr = curr->next) {
+		PREV_NODE(list, curr) = prev;
+		prev = curr;
+	}
+	list->prevs_valid = 1;
 }
 
-void prepend_ll(linked_list *list, void *data, size_t data_size) {
-	node *new_head = (node*) list->allocate (sizeof(node));
+// Built with LL_DEBUG_HANDLES every node gets a new generation so handles to removed nodes can be caught
+#ifdef LL_DEBUG_HANDLES
+static size_t handle_generation_ll = 0;
+#define STAMP_NODE(n) ((n)->generation = ++handle_generation_ll)
+#define RETIRE_NODE(n) ((n)->generation = 0)
+#define NODE_GENERATION(n) ((n)->generation)
+#else
+#define STAMP_NODE(n) ((void) 0)
+#define RETIRE_NODE(n) ((void) 0)
+#define NODE_GENERATION(n) 0
+#endif
+
+static node_pool *new_pool_ll(linked_list *list, size_t slot_size, size_t slab_size) {
+	node_pool *pool = (node_pool*) list->allocate (sizeof(node_pool));
+	pool->refs = 1;
+	pool->slot_size = slot_size;
+	pool->slab_size = slab_size;
+	pool->slab_left = 0;
+	pool->reserved = 0;
+	pool->live = 0;
+	pool->allocations = 0;
+	pool->deallocations = 0;
+	pool->outside_values = 0;
+	pool->bump = NULL;
+	pool->slabs = NULL;
+	pool->free_nodes = NULL;
+	pool->allocate = list->allocate;
+	pool->deallocate = list->deallocate;
+	return pool;
+}
 
-	if (is_empty_ll(list)) {
-		list->tail = new_head;
+// Bump allocates size bytes from the newest slab, a new slab is allocated when it does not fit
+static void *carve_ll(node_pool *pool, size_t size) {
+	size = ALIGN_UP(size);
+	if (pool->slab_left < size) {
+		size_t slab_size = (pool->slab_size > size) ? pool->slab_size : size;
+		void **slab = (void **) pool->allocate (SLAB_HEADER + slab_size);
+		*slab = pool->slabs;
+		pool->slabs = slab;
+		pool->bump = (char*) slab + SLAB_HEADER;
+		pool->slab_left = slab_size;
+		pool->reserved += SLAB_HEADER + slab_size;
+		pool->allocations++;
 	}
 
-	new_head->value = list->allocate (data_size);
-	list->deep_copyv(new_head->value, data, data_size);
-	new_head->val_size = data_size;
-	new_head->next = list->head;
-	list->head = new_head;
-	list->size++;
+	void *carved = pool->bump;
+	pool->bump += size;
+	pool->slab_left -= size;
+	return carved;
 }
 
-size_t append_ll(linked_list *list, void *data, size_t data_size) {
-	if (is_empty_ll(list)) {
-		prepend_ll(list, data, data_size);
-		return 0;
+static node *pool_node_ll(node_pool *pool, size_t node_size) {
+	if (IS_ARENA(pool)) {
+		return (node*) carve_ll(pool, node_size);
 	}
 
-	list->tail->next = (node*) list->allocate (sizeof(node));
-	list->tail->next->val_size = data_size;
-	list->tail->next->value = list->allocate (data_size);
-	list->deep_copyv(list->tail->next->value, data, data_size);
-	list->tail = list->tail->next;
-	list->tail->next = NULL;
-	return list->size++;
+	node *new_node = pool->free_nodes;
+	if (new_node != NULL) {
+		pool->free_nodes = new_node->next;
+		return new_node;
+	}
+	return (node*) carve_ll(pool, pool->slot_size);
 }
 
-int insert_ll(linked_list *list, void *data, size_t data_size, size_t index) {
-	if (index >= list->size) {
-		return 0;
+// Gives every slab back at once, nodes that were carved from them must not be used after
+static void free_slabs_ll(node_pool *pool) {
+	void *slab = pool->slabs;
+	void *prev_slab;
+	while (slab != NULL) {
+		prev_slab = *(void **) slab;
+		pool->deallocate(slab);
+		pool->deallocations++;
+		slab = prev_slab;
 	}
+	pool->slabs = NULL;
+	pool->slab_left = 0;
+	pool->reserved = 0;
+	pool->live = 0;
+	pool->bump = NULL;
+	pool->free_nodes = NULL;
+}
 
-	if (is_empty_ll(list)) {
-		if (index == 0) {
-			prepend_ll(list, data, data_size);
-			return 1;
-		}
-		return 0;
+static void release_pool_ll(node_pool *pool) {
+	if (pool == NULL || --pool->refs) {
+		return;
 	}
 
-	if (index == 0) {
-		prepend_ll(list, data, data_size);
-		return 1;
+	free_slabs_ll(pool);
+	pool->deallocate(pool);
+}
+
+#define STR_LEN(str) (((size_t*) (str))[-1])
+
+static void release_strings_ll(string_store *store) {
+	if (store == NULL || --store->refs) {
+		return;
 	}
 
-	if (index == (list->size - 1)) {
-		append_ll(list, data, data_size);
-		return 1;
+	retained_strings *retained = store->retained;
+	retained_strings *next;
+	while (retained != NULL) {
+		next = retained->next;
+		release_strings_ll(retained->store);
+		store->bytes->deallocate(retained);
+		retained = next;
 	}
 
-	node *curr = list->head;
-	size_t curr_index = 0;
-	index--;
-	while (curr != NULL && curr_index < index) {
-		curr = curr->next;
-		curr_index++;
+	if (store->entries != NULL) {
+		store->bytes->deallocate(store->entries);
 	}
+	void (*deallocate)(void *) = store->bytes->deallocate;
+	release_pool_ll(store->bytes);
+	deallocate(store);
+}
 
-	if (curr_index != index) {
-		return 0;
+// Keeps the strings of freed alive for as long as the strings of combined are, since its values now point at them
+static void retain_strings_ll(linked_list *combined, linked_list *freed) {
+	if (freed->strings == NULL || freed->strings == combined->strings) {
+		return;
+	} if (combined->strings == NULL) {
+		combined->strings = freed->strings;
+		combined->strings->refs++;
+		return;
 	}
 
-	node *new_node = (node*) list->allocate (sizeof(node));
-	new_node->value = list->allocate (data_size);
-	list->deep_copyv(new_node->value, data, data_size);
-	new_node->val_size = data_size;
-	new_node->next = curr->next;
-	curr->next = new_node;
-	list->size++;
-	return 1;
+	retained_strings *retained = (retained_strings*) combined->allocate (sizeof(retained_strings));
+	retained->store = freed->strings;
+	retained->next = combined->strings->retained;
+	combined->strings->retained = retained;
+	freed->strings->refs++;
 }
 
-int delete_ll(linked_list *list, size_t index) {
-	if (list->head == NULL || index >= list->size) {
-		return 0;
+// FNV-1a
+static size_t hash_str_ll(const char *str, size_t length) {
+	unsigned long long hash = 14695981039346656037ULL;
+	for (size_t i = 0; i < length; i++) {
+		hash = (hash ^ (unsigned char) str[i]) * 1099511628211ULL;
 	}
+	return (size_t) hash;
+}
 
-	node *prev;
-	node *curr = list->head;
+// Returns the table slot holding the string or the empty slot where it would go
+static string_entry *find_entry_ll(string_store *store, const char *str, size_t length, size_t hash) {
+	size_t i = hash & (store->capacity - 1);
+	while (store->entries[i].str != NULL) {
+		if (store->entries[i].hash == hash && STR_LEN(store->entries[i].str) == length && !memcmp(store->entries[i].str, str, length)) {
+			break;
+		}
+		i = (i + 1) & (store->capacity - 1);
+	}
+	return &store->entries[i];
+}
 
-	if (index == 0) {
-		list->head = curr->next;
-		if (curr == list->tail) {
-			list->tail = list->head;
+// Returns the stored copy of str, interning stores also give back the copy made earlier if there is one
+static char *store_str_ll(string_store *store, const char *str) {
+	size_t length = strlen(str);
+	size_t hash = 0;
+	string_entry *entry = NULL;
+
+	if (store->entries != NULL) {
+		hash = hash_str_ll(str, length);
+		entry = find_entry_ll(store, str, length, hash);
+		if (entry->str != NULL) {
+			return entry->str;
 		}
-		list->freev(curr->value);
-		free(curr);
-		list->size--;
-		return 1;
 	}
 
-	size_t curr_index = 0;
-	while (curr != NULL && curr_index < index) {
-		prev = curr;
-		curr = curr->next;
-		curr_index++;
+	char *copy = (char*) carve_ll(store->bytes, sizeof(size_t) + length + 1) + sizeof(size_t);
+	store->bytes->live += length + 1; // The length prefix and padding count as overhead
+	STR_LEN(copy) = length;
+	memcpy(copy, str, length + 1);
+
+	if (entry != NULL) {
+		entry->hash = hash;
+		entry->str = copy;
+		if (++store->entries_used * 10 > store->capacity * 7) {
+			string_entry *old_entries = store->entries;
+			size_t old_capacity = store->capacity;
+			store->capacity <<= 1;
+			store->entries = (string_entry*) store->bytes->allocate (store->capacity * sizeof(string_entry));
+			memset(store->entries, 0, store->capacity * sizeof(string_entry));
+			for (size_t i = 0; i < old_capacity; i++) {
+				if (old_entries[i].str != NULL) {
+					*find_entry_ll(store, old_entries[i].str, STR_LEN(old_entries[i].str), old_entries[i].hash) = old_entries[i];
+				}
+			}
+			store->bytes->deallocate(old_entries);
+		}
 	}
+	return copy;
+}
 
-	prev->next = curr->next;
-	if (curr == list->tail) {
-		list->tail = prev;
+// Bytes the block of a node takes from where it came from, estimated for the heap
+// Co-allocated nodes whose value is outside keep 1 byte after the header, see defragment_ll
+static size_t node_footprint_ll(linked_list *list, node *curr) {
+	int is_inline = list->co_allocate && VALUE_IS_INLINE(list, curr);
+	size_t size = !list->co_allocate ? HEADER_SIZE(list) : PAYLOAD_OFFSET(list) + (is_inline ? VAL_SIZE(list, curr) : 1);
+	if (list->pool == NULL) {
+		return HEAP_BLOCK(size);
 	}
-	list->freev(curr->value);
-	free(curr);
-	list->size--;
-	return 1;
+	return IS_ARENA(list->pool) ? ALIGN_UP(size) : list->pool->slot_size;
 }
 
-void *extract_head_ll(linked_list *list) {
-	if (list->head == NULL) {
-		return NULL;
+// Adds (sign 1) or removes (sign -1) the bytes of a node from the memory stats of the list
+static void count_node_ll(linked_list *list, node *curr, int sign) {
+	size_t val_size = VAL_SIZE(list, curr);
+	int is_inline = list->co_allocate && VALUE_IS_INLINE(list, curr);
+	size_t overhead = node_footprint_ll(list, curr) - HEADER_SIZE(list) - (is_inline ? val_size : 0);
+	if (!is_inline) {
+		overhead += HEAP_BLOCK(val_size) - val_size;
 	}
 
-	void *return_val = list->head->value;
+	list->memory.node_bytes += sign * HEADER_SIZE(list);
+	list->memory.value_bytes += sign * val_size;
+	list->memory.overhead_bytes += sign * overhead;
+}
 
-	node *old_head = list->head;
-	list->head = list->head->next;
-	if (list->size == 1) {
-		list->tail = list->head;
+// Recounts the bytes of every node, for functions that move nodes around in bulk
+static void recount_memory_ll(linked_list *list) {
+	list->memory.node_bytes = list->memory.value_bytes = list->memory.overhead_bytes = 0;
+	for (node *curr = list->head; curr != NULL; curr = curr->next) {
+		count_node_ll(list, curr, 1);
 	}
-	free(old_head);
-	list->size--;
-	return return_val;
 }
 
-void *extract_ll(linked_list *list, size_t index) {
-	if (index == 0) {
-		extract_head_ll(list);
-	} if (list->head == NULL || index >= list->size) {
-		return NULL;
+// Allocates a node with room for data_size bytes of value, the value is not copied
+static node *new_node_ll(linked_list *list, size_t data_size) {
+	node *new_node;
+	if (list->elem_size) {
+		data_size = list->elem_size;
 	}
-
-	size_t curr_index = 1;
-	node *prev = list->head;
-	node *curr = list->head->next;
-
-	while (curr_index < index && curr != NULL) {
-		prev = curr;
-		curr = curr->next;
-		curr_index++;
-	} if (curr_index != index || curr == NULL) {
-		return NULL;
-	} if (curr == list->tail) {
-		list->tail = prev;
+	if (list->pool != NULL) {
+		new_node = pool_node_ll(list->pool, PAYLOAD_OFFSET(list) + data_size);
+		if (IS_ARENA(list->pool) || data_size <= list->pool->slot_size - PAYLOAD_OFFSET(list)) {
+			new_node->value = (char*) new_node + PAYLOAD_OFFSET(list);
+		} else {
+			new_node->value = list->allocate (data_size);
+			list->pool->outside_values++;
+			list->memory.allocations++;
+		}
+	} else if (list->co_allocate) {
+		new_node = (node*) list->allocate (PAYLOAD_OFFSET(list) + data_size);
+		new_node->value = (char*) new_node + PAYLOAD_OFFSET(list);
+		list->memory.allocations++;
+	} else {
+		new_node = (node*) list->allocate (HEADER_SIZE(list));
+		new_node->value = list->allocate (data_size);
+		list->memory.allocations += 2;
 	}
-
-	prev->next = curr->next;
-	void *return_val = curr->value;
-	free(curr);
-	list->size--;
-	return return_val;
+	if (!list->elem_size) {
+		((sized_node*) new_node)->val_size = data_size;
+	} if (list->pool != NULL) {
+		list->pool->live += node_footprint_ll(list, new_node);
+	}
+	STAMP_NODE(new_node);
+	count_node_ll(list, new_node, 1);
+	return new_node;
 }
 
-void print_ll(linked_list *list) {
-	if (list->printv == NULL) {
-		printf("Attempted to call print_ll without giving the linked list a print function!\nYou can do so by set_print_ll\n");
-		return;
+// Allocates a node that points to data instead of holding a copy, the node takes ownership of data
+// Co-allocated nodes keep 1 byte after the header so the value can not be mistaken for an inline one
+static node *adopt_node_ll(linked_list *list, void *data, size_t data_size) {
+	node *new_node;
+	if (list->elem_size) {
+		data_size = list->elem_size;
 	}
-
-	node *curr = list->head;
-	size_t index = 0;
-	printf("\n----- ----- Linked List Start ----- -----\n");
-
-	while (curr != NULL) {
-		printf("Index: %zu ", index);
-		list->printv(curr->value);
-		curr = curr->next;
-		index++;
+	if (list->pool != NULL) {
+		new_node = pool_node_ll(list->pool, PAYLOAD_OFFSET(list) + 1);
+		list->pool->outside_values++;
+	} else if (list->co_allocate) {
+		new_node = (node*) list->allocate (PAYLOAD_OFFSET(list) + 1);
+		list->memory.allocations++;
+	} else {
+		new_node = (node*) list->allocate (HEADER_SIZE(list));
+		list->memory.allocations++;
 	}
-
-	printf("\n----- ----- Linked List |End| ----- -----\n");
+	new_node->value = data;
+	if (!list->elem_size) {
+		((sized_node*) new_node)->val_size = data_size;
+	} if (list->pool != NULL) {
+		list->pool->live += node_footprint_ll(list, new_node);
+	}
+	STAMP_NODE(new_node);
+	count_node_ll(list, new_node, 1);
+	return new_node;
 }
 
-linked_list *clone_linked_list(linked_list *list, void *(*allocator_p)(size_t)) {
-	linked_list *cloned_list = new_linked_list((allocator_p) ? allocator_p :list->allocate);
-	cloned_list->size = list->size;
-	cloned_list->printv = list->printv;
-	cloned_list->freev = list->freev;
-	cloned_list->deep_copyv = list->deep_copyv;
-	cloned_list->compare = list->compare;
-
-	if (is_empty_ll(list)) {
-		return cloned_list;
+// Gives the node back to where it was allocated from, does not touch the value
+// Arena nodes are only given back when the whole arena is
+static void release_node_ll(linked_list *list, node *old_node) {
+	RETIRE_NODE(old_node);
+	if (list->pool != NULL) {
+		list->pool->live -= node_footprint_ll(list, old_node);
+		if (IS_ARENA(list->pool)) {
+			return;
+		}
+		old_node->next = list->pool->free_nodes;
+		list->pool->free_nodes = old_node;
+	} else {
+		list->deallocate(old_node);
+		list->memory.deallocations++;
 	}
+}
 
-	cloned_list->head = (node*) cloned_list->allocate (sizeof(node));
-	cloned_list->head->value = cloned_list->allocate (list->head->val_size);
-	list->deep_copyv(cloned_list->head->value, list->head->value, list->head->val_size);
-	cloned_list->head->val_size = list->head->val_size;
+// Gives back the memory of a value that has its own allocation, what the value points to is not touched
+static void free_outside_value_ll(linked_list *list, node *old_node) {
+	list->deallocate(old_node->value);
+	list->memory.deallocations++;
+	if (list->pool != NULL) {
+		list->pool->outside_values--;
+	}
+}
 
-	node *clone_curr = cloned_list->head;
-	node *curr = list->head;
+// Frees the value of the node and the node
+// The free function of a co-allocated list only frees what the value points to, so the default free is skipped
+static void free_node_ll(linked_list *list, node *old_node) {
+	count_node_ll(list, old_node, -1);
+	if (list->co_allocate) {
+		if (list->freev != free) {
+			list->freev(old_node->value);
+		} if (!VALUE_IS_INLINE(list, old_node)) {
+			free_outside_value_ll(list, old_node);
+		}
+	} else if (list->freev == free) {
+		list->deallocate(old_node->value);
+		list->memory.deallocations++;
+	} else {
+		list->freev(old_node->value);
+		list->memory.deallocations++;
+	}
+	release_node_ll(list, old_node);
+}
 
-	if (curr->next == NULL) {
-		cloned_list->head->next = NULL;
-		cloned_list->tail = cloned_list->head;
-		return cloned_list;
+// Frees the node but hands back its value so the caller can free it with free. A co-allocated value of a heap list
+// made with malloc is moved to the start of its node, which is handed back whole, other co-allocated values are copied
+static void *take_value_ll(linked_list *list, node *old_node) {
+	void *value = old_node->value;
+	count_node_ll(list, old_node, -1);
+	if (list->co_allocate && VALUE_IS_INLINE(list, old_node) && list->pool == NULL && list->allocate == malloc && list->deallocate == free) {
+		RETIRE_NODE(old_node);
+		memmove(old_node, value, VAL_SIZE(list, old_node));
+		list->memory.deallocations++; // The block is no longer the list's
+		return old_node;
+	} if (list->co_allocate && VALUE_IS_INLINE(list, old_node)) {
+		value = malloc (VAL_SIZE(list, old_node));
+		memcpy(value, old_node->value, VAL_SIZE(list, old_node));
+	} else if (list->pool != NULL) {
+		list->pool->outside_values--;
 	}
+	release_node_ll(list, old_node);
+	return value;
+}
 
-	curr = curr->next;
+// 1 if nodes can be moved between the lists without reallocating them
+static int same_storage_ll(linked_list *a, linked_list *b) {
+	return a->elem_size == b->elem_size && a->co_allocate == b->co_allocate && a->deque == b->deque && a->pool == b->pool && (a->pool != NULL || a->deallocate == b->deallocate);
+}
 
-	while (curr != NULL) {
-		clone_curr->next = (node*) cloned_list->allocate (sizeof(node));
-		clone_curr = clone_curr->next;
-		clone_curr->value = cloned_list->allocate (curr->val_size);
-		list->deep_copyv(clone_curr->value, curr->value, curr->val_size);
-		clone_curr->val_size = curr->val_size;
-		curr = curr->next;
+// Makes list allocate its nodes the same way as source does, sharing its pool if it has one
+// Also takes the element size since it decides the node layout, and the strings the values may point to
+// With own_storage set a pooled source gets a new pool of the same shape carved from the allocater of list instead
+static void share_storage_ll(linked_list *list, linked_list *source, int own_storage) {
+	release_pool_ll(list->pool);
+	list->elem_size = source->elem_size;
+	list->co_allocate = source->co_allocate;
+	list->deque = source->deque;
+	list->prevs_valid = 0; // Nodes get linked in by the caller
+	if (own_storage) {
+		list->pool = (source->pool == NULL) ? NULL : new_pool_ll(list, source->pool->slot_size, source->pool->slab_size);
+	} else {
+		list->pool = source->pool;
+		list->deallocate = source->deallocate;
+		if (list->pool != NULL) {
+			list->pool->refs++;
+		}
+	}
+	release_strings_ll(list->strings);
+	list->strings = source->strings;
+	if (list->strings != NULL) {
+		list->strings->refs++;
 	}
-
-	cloned_list->tail = clone_curr;
-	cloned_list->tail->next = NULL;
-	return cloned_list;
 }
 
-void reverse_ll(linked_list *list) {
-	if (is_empty_ll(list) || list->head->next == NULL) {
-		return;
+// Returns a node of list holding the value of old_node, which belongs to source
+// If the storage differs the value bytes are moved into a new node and old_node is released
+static node *move_node_ll(linked_list *list, linked_list *source, node *old_node) {
+	if (same_storage_ll(list, source)) {
+		return old_node;
 	}
 
-	node *prev = list->head;
-	node *curr = list->head->next;
-	node *next = list->head->next->next;
-	list->head->next = NULL;
+	node *new_node = new_node_ll(list, VAL_SIZE(source, old_node));
+	memcpy(new_node->value, old_node->value, VAL_SIZE(source, old_node));
+	count_node_ll(source, old_node, -1);
+	if (!source->co_allocate || !VALUE_IS_INLINE(source, old_node)) {
+		free_outside_value_ll(source, old_node);
+	}
+	release_node_ll(source, old_node);
+	return new_node;
+}
 
-	while (next != NULL) {
-		curr->next = prev;
-		prev = curr;
-		curr = next;
-		next = next->next;
+// Copies a value with the given copy function, size is ignored for fixed size lists
+// Plain copies of the common fixed sizes are inlined
+static void copy_value_ll(linked_list *list, void * restrict destination, const void * restrict source, size_t size, void *(*copy)(void * restrict, const void * restrict, size_t)) {
+	if (list->elem_size) {
+		size = list->elem_size;
+	} if (copy == memcpy) {
+		switch (size) {
+			case 1: memcpy(destination, source, 1); return;
+			case 2: memcpy(destination, source, 2); return;
+			case 4: memcpy(destination, source, 4); return;
+			case 8: memcpy(destination, source, 8); return;
+			case 16: memcpy(destination, source, 16); return;
+		}
 	}
+	copy(destination, source, size);
+}
 
-	curr->next = prev;
-	node *temp = list->head;
-	list->head = list->tail;
-	list->tail = temp;
+static skip_tower *new_tower_ll(linked_list *list, node *target, size_t height) {
+	skip_tower *tower = (skip_tower*) list->allocate (sizeof(skip_tower) + height * sizeof(skip_link));
+	tower->target = target;
+	tower->height = height;
+	list->memory.allocations++;
+	list->index_bytes += HEAP_BLOCK(sizeof(skip_tower) + height * sizeof(skip_link));
+	return tower;
 }
 
-void *get_data_ll(linked_list *list, size_t index) {
-	if (index >= list->size || is_empty_ll(list)) {
-		return NULL;
+static void free_tower_ll(linked_list *list, skip_tower *tower) {
+	list->memory.deallocations++;
+	list->index_bytes -= HEAP_BLOCK(sizeof(skip_tower) + tower->height * sizeof(skip_link));
+	list->deallocate(tower);
+}
+
+// Height of a new tower, each level above the list holds about a quarter of the level below
+static size_t tower_height_ll(skip_index *skip) {
+	skip->seed ^= skip->seed << 13;
+	skip->seed ^= skip->seed >> 7;
+	skip->seed ^= skip->seed << 17;
+	unsigned long long bits = skip->seed;
+	size_t height = 0;
+	while ((bits & 3) == 0 && height < SKIP_LEVELS - 1) {
+		height++;
+		bits >>= 2;
 	}
+	return height;
+}
 
-	if (index == list->size - 1) {
-		return list->tail->value;
+// Frees every tower but the header, all levels of the header are left pointing at nothing
+static void clear_skip_ll(linked_list *list) {
+	skip_tower *tower = list->skip->header->links[0].next;
+	skip_tower *next;
+	while (tower != NULL) {
+		next = tower->links[0].next;
+		free_tower_ll(list, tower);
+		tower = next;
 	}
-	
-	node *curr = list->head;
-	size_t curr_index = 0;
-	while (curr != NULL && curr_index < index) {
-		curr = curr->next;
-		curr_index++;
+	for (size_t level = 0; level < SKIP_LEVELS; level++) {
+		list->skip->header->links[level].next = NULL;
+		list->skip->header->links[level].span = list->size + 1;
 	}
-
-	if (curr_index == index) {
-		return curr->value;
-	} return NULL;
+	list->skip->levels = 0;
+	list->skip->valid = 1;
 }
 
-void map_ll(linked_list *list, void (*func)(void *)) {
-	node *curr = list->head;
-	while (curr != NULL) {
-		func(curr->value);
-		curr = curr->next;
+// Drops the fingers and marks the skip and hash index and previous pointers as out of date,
+// for functions that relink many nodes at once
+static void invalidate_positions_ll(linked_list *list) {
+	settle_links_ll(list);
+	list->prevs_valid = 0;
+	list->finger = NULL;
+	list->version++;
+	if (list->hash != NULL) {
+		list->hash->valid = 0;
+	}
+	if (list->skip != NULL) {
+		list->skip->valid = 0;
 	}
 }
 
-void filter_ll(linked_list *list, int (*func)(void *)) { // func should return 1 if the value should be removed else 0
-	if (is_empty_ll(list)) {
+// Rebuilds the towers of an out of date skip index in one walk over the list
+static void refresh_skip_ll(linked_list *list) {
+	if (list->skip == NULL || list->skip->valid) {
 		return;
 	}
-
-	if (func == NULL) {
-		printf("Attempted to filter linked list when the filter function is NULL?\n");
-		return;
+	settle_links_ll(list);
+
+	clear_skip_ll(list);
+	skip_path last;
+	size_t level;
+	for (level = 0; level < SKIP_LEVELS; level++) {
+		last.update[level] = list->skip->header;
+		last.rank[level] = 0;
 	}
 
-	node *prev = list->head;
-	node *curr = list->head->next;
-
-	while (func(prev->value)) {
-		list->freev(prev->value);
-		free(prev);
-		list->size--;
-		if (curr != NULL) {
-			prev = curr;
-			curr = curr->next;
-		} else {
-			list->head = NULL;
-			list->tail = NULL;
-			return;
+	size_t rank = 1;
+	size_t height;
+	skip_tower *tower;
+	for (node *curr = list->head; curr != NULL; curr = curr->next, rank++) {
+		height = tower_height_ll(list->skip);
+		if (height == 0) {
+			continue;
+		}
+		tower = new_tower_ll(list, curr, height);
+		for (level = 0; level < height; level++) {
+			last.update[level]->links[level].next = tower;
+			last.update[level]->links[level].span = rank - last.rank[level];
+			last.update[level] = tower;
+			last.rank[level] = rank;
+		} if (height > list->skip->levels) {
+			list->skip->levels = height;
 		}
 	}
 
-	list->head = prev;
+	for (level = 0; level < list->skip->levels; level++) {
+		last.update[level]->links[level].next = NULL;
+		last.update[level]->links[level].span = list->size + 1 - last.rank[level];
+	}
+}
 
-	while (curr != NULL) {
-		if (func(curr->value)) {
-			prev->next = curr->next;
-			list->freev(curr->value);
-			free(curr);
-			list->size--;
-		} else {
-			prev = curr;
+// Returns the node before index, NULL for index 0, and leaves the finger on it
+// The walk starts from the finger when it is at or before the node. If the skip index is up to date it fills path
+// with the towers that link over index, a NULL path lets a finger up to FINGER_REACH nodes away be used instead
+static node *node_before_ll(linked_list *list, size_t index, skip_path *path) {
+	settle_links_ll(list);
+	int finger_before = list->finger != NULL && list->finger_index < index;
+	node *curr = list->head;
+	size_t rank = 1;
+
+	if (list->skip != NULL && list->skip->valid && (path != NULL || !finger_before || index - list->finger_index > FINGER_REACH)) {
+		skip_path unused;
+		path = (path != NULL) ? path : &unused;
+		skip_tower *tower = list->skip->header;
+		size_t tower_rank = 0;
+		for (size_t level = list->skip->levels; level-- > 0;) {
+			while (tower->links[level].next != NULL && tower_rank + tower->links[level].span <= index) {
+				tower_rank += tower->links[level].span;
+				tower = tower->links[level].next;
+			}
+			path->update[level] = tower;
+			path->rank[level] = tower_rank;
+		} if (tower != list->skip->header) {
+			curr = tower->target;
+			rank = tower_rank;
 		}
-		curr = prev->next;
+	} if (finger_before && list->finger_index + 1 > rank) {
+		curr = list->finger;
+		rank = list->finger_index + 1;
 	}
 
-	list->tail = prev;
-	list->tail->next = NULL;
+	if (index == 0) {
+		return NULL;
+	} if (index == list->size) {
+		curr = list->tail;
+	} else if (index + 1 == list->size && list->deque && list->prevs_valid) {
+		curr = PREV_NODE(list, list->tail);
+	} else {
+		for (; rank < index; rank++) {
+			curr = curr->next;
+		}
+	}
+	list->finger = curr;
+	list->finger_index = index - 1;
+	return curr;
 }
 
-void *iter_ll(linked_list *new_linked_list) {
-	static node *curr = NULL;
-	if (new_linked_list == NULL) {
-		if (curr == NULL) {
-			return NULL;
+// Returns the node at index without changing the list, index has to be smaller than the size of the list
+// The walk starts from the finger of the list or the read finger of this thread when one is at or before the node,
+// or from the skip index if it is up to date and the fingers are more than FINGER_REACH nodes away
+static node *node_at_ll(linked_list *list, size_t index) {
+	read_finger *finger = &read_finger_ll;
+	node *curr = list->head;
+	size_t rank = 0;
+
+	if (index == list->size - 1) {
+		return list->tail;
+	} if (list->finger != NULL && list->finger_index <= index) {
+		curr = list->finger;
+		rank = list->finger_index;
+	} if (finger->list_id == list->id && finger->version == list->version && finger->index <= index && finger->index >= rank) {
+		curr = finger->target;
+		rank = finger->index;
+	}
+
+	if (list->skip != NULL && list->skip->valid && index - rank > FINGER_REACH) {
+		skip_tower *tower = list->skip->header;
+		size_t tower_rank = 0;
+		for (size_t level = list->skip->levels; level-- > 0;) {
+			while (tower->links[level].next != NULL && tower_rank + tower->links[level].span <= index + 1) {
+				tower_rank += tower->links[level].span;
+				tower = tower->links[level].next;
+			}
+		} if (tower != list->skip->header && tower_rank - 1 > rank) {
+			curr = tower->target;
+			rank = tower_rank - 1;
 		}
-		
-		void *return_val = curr->value;
-		curr = curr->next;
-		return return_val;
+	}
+	for (; rank < index; rank++) {
+		curr = NEXT_NODE(list, curr);
 	}
 
-	curr = new_linked_list->head;
-	return NULL;
+	finger->list_id = list->id;
+	finger->version = list->version;
+	finger->target = curr;
+	finger->index = index;
+	return curr;
 }
 
-linked_list *slice_linked_list(linked_list* list, size_t start, size_t end, void *(*allocator_p)(size_t)) {
-	if (end < start) {
-		printf("Start index cannot be greater than end index...\n");
-		return NULL;
-	} else if (end >= list->size || is_empty_ll(list)) {
-		return NULL; // No message here
+// Gives the node that was just linked in at index a tower if it draws one, path comes from node_before_ll
+static void skip_insert_ll(linked_list *list, skip_path *path, node *new_node, size_t index) {
+	if (list->skip == NULL || !list->skip->valid) {
+		return;
 	}
 
-	linked_list *new_list = new_linked_list((allocator_p) ? allocator_p : list->allocate);
-	new_list->printv = list->printv;
-	new_list->freev = list->freev;
-	new_list->deep_copyv = list->deep_copyv;
-	new_list->compare = list->compare;
-	new_list->size = end - start + 1;
+	skip_index *skip = list->skip;
+	size_t position = index + 1;
+	size_t height = tower_height_ll(skip);
+	size_t level;
+	for (; skip->levels < height; skip->levels++) {
+		path->update[skip->levels] = skip->header;
+		path->rank[skip->levels] = 0;
+		skip->header->links[skip->levels].next = NULL;
+		skip->header->links[skip->levels].span = list->size;
+	}
 
-	node *curr = list->head;
-	size_t cur_index = 0;
-	while (cur_index < start) {
-		curr = curr->next;
-		cur_index++;
+	if (height > 0) {
+		skip_tower *tower = new_tower_ll(list, new_node, height);
+		for (level = 0; level < height; level++) {
+			skip_link *link = &path->update[level]->links[level];
+			tower->links[level].next = link->next;
+			tower->links[level].span = path->rank[level] + link->span + 1 - position;
+			link->next = tower;
+			link->span = position - path->rank[level];
+		}
 	}
+	for (level = height; level < skip->levels; level++) {
+		path->update[level]->links[level].span++;
+	}
+}
 
-	new_list->head = (node*) new_list->allocate (sizeof(node));
-	new_list->head->value = new_list->allocate (curr->val_size);
-	new_list->head->val_size = curr->val_size;
-	list->deep_copyv(new_list->head->value, curr->value, curr->val_size);
-	node *new_curr = new_list->head;
-	
-	while (cur_index < end) {
-		curr = curr->next;
-		new_curr->next = (node*) new_list->allocate (sizeof(node));
-		new_curr = new_curr->next;
-		new_curr->value = new_list->allocate (curr->val_size);
-		list->deep_copyv(new_curr->value, curr->value, curr->val_size);
-		new_curr->val_size = curr->val_size;
-		cur_index++;
+// Takes the tower of the node that was just unlinked from index out of the skip index, path comes from node_before_ll
+static void skip_remove_ll(linked_list *list, skip_path *path, size_t index) {
+	if (list->skip == NULL || !list->skip->valid) {
+		return;
 	}
 
-	new_list->tail = new_curr;
-	new_list->tail->next = NULL;
+	skip_index *skip = list->skip;
+	size_t position = index + 1;
+	skip_tower *removed = NULL;
+	for (size_t level = 0; level < skip->levels; level++) {
+		skip_link *link = &path->update[level]->links[level];
+		if (link->next != NULL && path->rank[level] + link->span == position) {
+			removed = link->next;
+			link->span += removed->links[level].span - 1;
+			link->next = removed->links[level].next;
+		} else {
+			link->span--;
+		}
+	}
 
-	return new_list;
+	if (removed != NULL) {
+		free_tower_ll(list, removed);
+	}
+	while (skip->levels > 0 && skip->header->links[skip->levels - 1].next == NULL) {
+		skip->levels--;
+	}
 }
 
-linked_list *seperate_linked_list(linked_list *list, int(*func)(void *), void *(*allocator_p)(size_t)) { // func should return 1 if going in seperated list else 0
-	linked_list *new_list = new_linked_list((allocator_p) ? allocator_p : list->allocate);
-	new_list->printv = list->printv;
-	new_list->freev = list->freev;
-	new_list->deep_copyv = list->deep_copyv;
-	new_list->compare = list->compare;
-	new_list->size = 0;
+// Allocates memory of the hash index and counts it as overhead of the list
+static void *hash_allocate_ll(linked_list *list, size_t size) {
+	list->memory.allocations++;
+	list->index_bytes += HEAP_BLOCK(size);
+	return list->allocate (size);
+}
 
-	if (list == NULL || list->head == NULL) {
-		return new_list;
+static void hash_deallocate_ll(linked_list *list, void *block, size_t size) {
+	list->memory.deallocations++;
+	list->index_bytes -= HEAP_BLOCK(size);
+	list->deallocate(block);
+}
+
+// Returns the group of values equal to value or the empty slot it would go in
+// Groups whose values were all removed are passed over until the table is rehashed
+static value_group *find_group_ll(linked_list *list, const void *value, size_t hash) {
+	size_t mask = list->hash->capacity - 1;
+	value_group *group;
+	for (size_t i = hash & mask;; i = (i + 1) & mask) {
+		group = &list->hash->groups[i];
+		if (group->capacity == 0 || (group->count > 0 && group->hash == hash && !list->compare(group->occurrences[0].target->value, value))) {
+			return group;
+		}
 	}
+}
 
-	node *new_curr = new_list->head;
-	node *prev = NULL;
-	node *curr = list->head;
-	node *next = NULL;
+// Frees every group and makes a table with room for about live groups, the table is left empty
+static void reset_groups_ll(linked_list *list, size_t live) {
+	hash_index *index = list->hash;
+	for (size_t i = 0; i < index->capacity; i++) {
+		if (index->groups[i].capacity) {
+			hash_deallocate_ll(list, index->groups[i].occurrences, index->groups[i].capacity * sizeof(occurrence));
+		}
+	}
+	hash_deallocate_ll(list, index->groups, index->capacity * sizeof(value_group));
 
-	while (curr != NULL) {
-		next = curr->next;
+	for (index->capacity = 64; (live + 1) * 20 > index->capacity * 7; index->capacity *= 2);
+	index->groups = (value_group*) hash_allocate_ll(list, index->capacity * sizeof(value_group));
+	memset(index->groups, 0, index->capacity * sizeof(value_group));
+	index->groups_used = 0;
+}
 
-		if (func(curr->value)) {
-			if (new_curr == NULL) {
-				new_list->head = new_curr = curr;
-			} else {
-				new_curr->next = curr;
-				new_curr = curr;
-			}
+// Moves the groups that still have values into a new table, dropping the removed ones
+static void rehash_groups_ll(linked_list *list) {
+	hash_index *index = list->hash;
+	value_group *old_groups = index->groups;
+	size_t old_capacity = index->capacity;
+	size_t live = 0;
+	size_t i;
+	for (i = 0; i < old_capacity; i++) {
+		live += old_groups[i].count > 0;
+	}
 
-			if (prev == NULL) {
-				list->head = next;
-			} else {
-				prev->next = next;
-			}
+	for (index->capacity = 64; (live + 1) * 20 > index->capacity * 7; index->capacity *= 2);
+	index->groups = (value_group*) hash_allocate_ll(list, index->capacity * sizeof(value_group));
+	memset(index->groups, 0, index->capacity * sizeof(value_group));
+	index->groups_used = live;
+
+	size_t mask = index->capacity - 1;
+	size_t slot;
+	for (i = 0; i < old_capacity; i++) {
+		if (old_groups[i].count > 0) {
+			for (slot = old_groups[i].hash & mask; index->groups[slot].capacity; slot = (slot + 1) & mask);
+			index->groups[slot] = old_groups[i];
+		} else if (old_groups[i].capacity) {
+			hash_deallocate_ll(list, old_groups[i].occurrences, old_groups[i].capacity * sizeof(occurrence));
+		}
+	}
+	hash_deallocate_ll(list, old_groups, old_capacity * sizeof(value_group));
+}
 
-			new_list->size++;
-			list->size--;
+// Key of an occurrence after the edits made since it was added, O(edit_count)
+static size_t current_key_ll(hash_index *index, const occurrence *entry) {
+	size_t key = entry->key;
+	for (size_t i = entry->stamp; i < index->edit_count; i++) {
+		if (index->edits[i].inserted) {
+			key += index->edits[i].key <= key;
 		} else {
-			prev = curr;
+			key -= index->edits[i].key < key;
 		}
-		curr = next;
 	}
-	
-	list->tail = prev;
-	list->tail->next = NULL;
-	new_list->tail = new_curr;
-	new_list->tail->next = NULL;
+	return key;
+}
 
-	return new_list;
+// Adds new_node with the given key to the group of its value. place is PLACE_FIRST for the head, PLACE_LAST for the
+// tail and PLACE_BY_KEY for a node in the middle, which is put in list order by a binary search on the current keys
+static void add_occurrence_ll(linked_list *list, node *new_node, size_t key, int place) {
+	hash_index *index = list->hash;
+	if ((index->groups_used + 1) * 10 > index->capacity * 7) {
+		rehash_groups_ll(list);
+	}
+
+	size_t hash = index->hash(new_node->value);
+	value_group *group = find_group_ll(list, new_node->value, hash);
+	if (group->capacity == 0) {
+		group->hash = hash;
+		group->capacity = 1;
+		group->occurrences = (occurrence*) hash_allocate_ll(list, sizeof(occurrence));
+		index->groups_used++;
+	} else if (group->count == group->capacity) {
+		occurrence *grown = (occurrence*) hash_allocate_ll(list, 2 * group->capacity * sizeof(occurrence));
+		memcpy(grown, group->occurrences, group->count * sizeof(occurrence));
+		hash_deallocate_ll(list, group->occurrences, group->capacity * sizeof(occurrence));
+		group->occurrences = grown;
+		group->capacity *= 2;
+	}
+
+	size_t at = (place == PLACE_FIRST) ? 0 : group->count;
+	if (place == PLACE_BY_KEY) {
+		size_t low = 0;
+		size_t middle;
+		while (low < at) {
+			middle = low + (at - low) / 2;
+			if (current_key_ll(index, &group->occurrences[middle]) < key) {
+				low = middle + 1;
+			} else {
+				at = middle;
+			}
+		}
+	}
+	memmove(group->occurrences + at + 1, group->occurrences + at, (group->count - at) * sizeof(occurrence));
+	group->occurrences[at].target = new_node;
+	group->occurrences[at].key = key;
+	group->occurrences[at].stamp = index->edit_count;
+	group->count++;
 }
 
-void merge_sort_ll(linked_list *list) {
-	if (list->head == NULL || list->head->next == NULL) {
+// Rebuilds the groups and keys of an out of date hash index in one walk over the list
+static void refresh_hash_ll(linked_list *list) {
+	hash_index *index = list->hash;
+	if (index->valid) {
 		return;
 	}
+	settle_links_ll(list);
+
+	reset_groups_ll(list, index->groups_used); // Room for the groups it had, rehashing makes more when needed
+	index->head_key = KEY_ORIGIN;
+	index->edit_count = 0;
+	size_t key = KEY_ORIGIN;
+	for (node *curr = list->head; curr != NULL; curr = curr->next) {
+		add_occurrence_ll(list, curr, key++, PLACE_LAST);
+	}
+	index->valid = 1;
+}
 
-	if (list->compare == NULL) {
-		printf("Called merge_sort_ll without giving the linked list a compare function?!\nSet it by set_compare_ll\n");
+// Gives every occurrence its index plus head_key as key again and clears the edits, in one walk over the list
+// The occurrences of every group are in list order, so the walk meets them one after the other
+static void renumber_keys_ll(linked_list *list) {
+	hash_index *index = list->hash;
+	size_t i;
+	for (i = 0; i < index->capacity; i++) {
+		index->groups[i].renumbered = 0;
+	}
+
+	size_t key = index->head_key;
+	occurrence *entry;
+	for (node *curr = list->head; curr != NULL; curr = curr->next) {
+		value_group *group = find_group_ll(list, curr->value, index->hash(curr->value));
+		entry = &group->occurrences[group->renumbered++];
+		entry->key = key++;
+		entry->stamp = 0;
+	}
+	index->edit_count = 0;
+}
+
+// Notes that the node with the given key was linked in or out of the middle, so lookups can still tell every index
+static void add_key_edit_ll(linked_list *list, size_t key, int inserted) {
+	hash_index *hash = list->hash;
+	if (hash->edit_count == hash->edit_capacity) {
+		key_edit *grown = (key_edit*) hash_allocate_ll(list, 2 * hash->edit_capacity * sizeof(key_edit));
+		memcpy(grown, hash->edits, hash->edit_count * sizeof(key_edit));
+		hash_deallocate_ll(list, hash->edits, hash->edit_capacity * sizeof(key_edit));
+		hash->edits = grown;
+		hash->edit_capacity *= 2;
+	}
+	hash->edits[hash->edit_count].key = key;
+	hash->edits[hash->edit_count].inserted = inserted;
+	hash->edit_count++;
+}
+
+// Renumbers the keys once replaying the edits would cost more than about twice the square root of the size
+static void limit_key_edits_ll(linked_list *list) {
+	size_t limit = MIN_KEY_EDITS;
+	while (limit * limit < 4 * list->size) {
+		limit *= 2;
+	} if (list->hash->edit_count >= limit) {
+		renumber_keys_ll(list);
+	}
+}
+
+// Adds the node that was just linked in at index to the hash index. For an UNKNOWN_INDEX the groups are rebuilt, it only
+// happens when the node before it can not be found in the index either
+static void hash_insert_ll(linked_list *list, node *new_node, size_t index) {
+	hash_index *hash = list->hash;
+	if (hash == NULL || !hash->valid) {
 		return;
 	}
 
-	node** nodes = (node **) malloc (list->size * sizeof(node *));
-	node** next_nodes = (node **) malloc (list->size * sizeof(node *));
-	node** temp_nodes;
-	size_t i;
-	node* curr = list->head;
+	if (index == UNKNOWN_INDEX) {
+		hash->valid = 0;
+		refresh_hash_ll(list);
+	} else if (index == 0) {
+		add_occurrence_ll(list, new_node, --hash->head_key, PLACE_FIRST);
+	} else if (index == list->size - 1) {
+		add_occurrence_ll(list, new_node, hash->head_key + index, PLACE_LAST);
+	} else {
+		add_key_edit_ll(list, hash->head_key + index, 1);
+		add_occurrence_ll(list, new_node, hash->head_key + index, PLACE_BY_KEY); // After the edit so it is not moved by it
+		limit_key_edits_ll(list);
+	}
+}
 
-	for (i = 0; i < list->size; i++) {
-		nodes[i] = curr;
-		curr = curr->next;
+// Takes the node that was just unlinked from index, which can be UNKNOWN_INDEX, out of the hash index
+static void hash_remove_ll(linked_list *list, node *old_node, size_t index) {
+	hash_index *hash = list->hash;
+	if (hash == NULL || !hash->valid) {
+		return;
+	} if (index == UNKNOWN_INDEX) {
+		hash->valid = 0;
+		refresh_hash_ll(list);
+		return;
 	}
 
-	curr = nodes[0];
-	size_t endi;
-	size_t endj;
-	size_t j;
-	int icontinue;
-	int jcontinue;
-	int isi;
-	size_t subsize = 1;
-	size_t subsize2;
-	size_t k;
+	value_group *group = find_group_ll(list, old_node->value, hash->hash(old_node->value));
+	size_t i = 0;
+	while (group->occurrences[i].target != old_node) {
+		i++;
+	}
+	group->count--;
+	memmove(group->occurrences + i, group->occurrences + i + 1, (group->count - i) * sizeof(occurrence));
 
-	while (subsize < list->size) {
-		i = k = 0;
-		j = endi = subsize;
-		subsize2 = subsize << 1;
-		endj = (list->size > subsize2) ? subsize2 : list->size;
-		jcontinue = (j < endj);
-		icontinue = (i < endi);
-		while (i < list->size) {
-			while (icontinue || jcontinue) {
-				if (icontinue && jcontinue) {
-					if (list->compare(nodes[i]->value, nodes[j]->value) >= 0) {
-						isi = 1;
-					} else {
-						isi = 0;
-					}
-				} else {
-					if (icontinue) {
-						isi = 1;
-					} else {
-						isi = 0;
-					}
-				}
-				if (isi) {
-					next_nodes[k++] = nodes[i++];
-					icontinue = (i < endi);
-				} else {
-					next_nodes[k++] = nodes[j++];
-					jcontinue = (j < endj);
-				}
-			}
-			i = endj;
-			subsize2 = i + subsize;
-			j = endi = (list->size > subsize2) ? subsize2 : list->size;
-			subsize2 = j + subsize;
-			endj = (list->size > subsize2) ? subsize2 : list->size;
-			jcontinue = (j < endj);
-			icontinue = (i < endi);
-		}
-		temp_nodes = nodes;
-		nodes = next_nodes;
-		next_nodes = temp_nodes;
-		subsize <<= 1;
+	if (index == 0) {
+		hash->head_key++;
+	} else if (index != list->size) {
+		add_key_edit_ll(list, hash->head_key + index, 0);
+		limit_key_edits_ll(list);
+	}
+}
+
+// Rebuilds the indexes a function that relinked the list left out of date, so reads right after it can use them
+// Only called by functions that already take O(n)
+static void refresh_indexes_ll(linked_list *list) {
+	refresh_skip_ll(list);
+	if (list->hash != NULL) {
+		refresh_hash_ll(list);
 	}
+}
 
-	for (i = 1; i < list->size; i++) {
-		nodes[i - 1]->next = nodes[i];
+// Frees the hash index and its groups and turns it off
+static void free_hash_ll(linked_list *list) {
+	if (list->hash == NULL) {
+		return;
+	}
+	reset_groups_ll(list, 0);
+	hash_deallocate_ll(list, list->hash->groups, list->hash->capacity * sizeof(value_group));
+	hash_deallocate_ll(list, list->hash->edits, list->hash->edit_capacity * sizeof(key_edit));
+	hash_deallocate_ll(list, list->hash, sizeof(hash_index));
+	list->hash = NULL;
+}
+
+// Frees the skip index, its towers and turns it off
+static void free_skip_ll(linked_list *list) {
+	if (list->skip == NULL) {
+		return;
+	}
+	clear_skip_ll(list);
+	list->deallocate(list->skip->header);
+	list->deallocate(list->skip);
+	list->skip = NULL;
+	list->memory.deallocations += 2;
+	list->index_bytes -= HEAP_BLOCK(sizeof(skip_index)) + HEAP_BLOCK(sizeof(skip_tower) + SKIP_LEVELS * sizeof(skip_link));
+}
+
+// Frees the linked list struct and lets go of its pool, the nodes must already be gone or moved
+static void free_list_struct_ll(linked_list *list) {
+	free_skip_ll(list);
+	free_hash_ll(list);
+	release_pool_ll(list->pool);
+	release_strings_ll(list->strings);
+	list->deallocate(list);
+}
+
+void set_free_ll(linked_list *list, void (*free_p)(void *)) {
+	list->freev = free_p;
+}
+
+void set_print_ll(linked_list *list, void (*print_p)(void *)) {
+	list->printv = print_p;
+}
+
+void set_deep_copy_ll(linked_list *list, void *(*deep_copy_p)(void * restrict destination, const void * restrict source, size_t size)) {
+	list->deep_copyv = deep_copy_p;
+}
+
+void set_allocater_ll(linked_list *list, void *(allocate_p)(size_t size)) {
+	list->allocate = allocate_p;
+}
+
+void set_deallocater_ll(linked_list *list, void (*deallocate_p)(void *)) {
+	list->deallocate = deallocate_p;
+}
+
+void set_compare_ll(linked_list *list, int (*compare_p)(const void *a, const void *b)) {
+	list->compare = compare_p;
+}
+
+int set_co_allocate_ll(linked_list *list, int co_allocate) {
+	if (!is_empty_ll(list)) {
+		return 0;
+	}
+
+	release_pool_ll(list->pool);
+	list->pool = NULL;
+	list->co_allocate = (co_allocate != 0);
+	return 1;
+}
+
+int set_deque_ll(linked_list *list, int deque) {
+	if (!is_empty_ll(list)) {
+		return 0;
+	}
+
+	release_pool_ll(list->pool); // The slots were sized for the old node layout
+	list->pool = NULL;
+	list->deque = (deque != 0);
+	return 1;
+}
+
+int set_pool_ll(linked_list *list, size_t value_size, size_t slab_nodes) {
+	if (!is_empty_ll(list) || slab_nodes == 0) {
+		return 0;
+	}
+
+	size_t slot_size = PAYLOAD_OFFSET(list) + ALIGN_UP(value_size ? value_size : 1);
+	node_pool *pool = new_pool_ll(list, slot_size, slot_size * slab_nodes);
+
+	release_pool_ll(list->pool);
+	list->pool = pool;
+	list->co_allocate = 1;
+	return 1;
+}
+
+int set_arena_ll(linked_list *list, size_t chunk_size) {
+	if (!is_empty_ll(list)) {
+		return 0;
+	}
+
+	node_pool *arena = new_pool_ll(list, 0, ALIGN_UP(chunk_size ? chunk_size : 1));
+
+	release_pool_ll(list->pool);
+	list->pool = arena;
+	list->co_allocate = 1;
+	return 1;
+}
+
+int set_skip_index_ll(linked_list *list, int use_index) {
+	if (!use_index) {
+		free_skip_ll(list);
+		return 1;
+	} if (list->skip != NULL) {
+		return 1;
+	}
+
+	list->skip = (skip_index*) list->allocate (sizeof(skip_index));
+	list->skip->header = (skip_tower*) list->allocate (sizeof(skip_tower) + SKIP_LEVELS * sizeof(skip_link));
+	list->skip->header->target = NULL;
+	list->skip->header->height = SKIP_LEVELS;
+	list->skip->header->links[0].next = NULL;
+	list->skip->seed = 0x9E3779B97F4A7C15ULL ^ (unsigned long long) (size_t) list;
+	list->skip->valid = 0;
+	list->memory.allocations += 2;
+	list->index_bytes += HEAP_BLOCK(sizeof(skip_index)) + HEAP_BLOCK(sizeof(skip_tower) + SKIP_LEVELS * sizeof(skip_link));
+	refresh_skip_ll(list);
+	return 1;
+}
+
+int set_hash_index_ll(linked_list *list, size_t (*hash_p)(const void *value)) {
+	if (hash_p == NULL) {
+		free_hash_ll(list);
+		return 1;
+	} if (list->compare == NULL) {
+		printf("Attempted to set a hash index without giving the linked list a compare function!\nSet it by set_compare_ll\n");
+		return 0;
+	} if (list->hash == NULL) {
+		list->hash = (hash_index*) hash_allocate_ll(list, sizeof(hash_index));
+		list->hash->capacity = 64;
+		list->hash->groups = (value_group*) hash_allocate_ll(list, list->hash->capacity * sizeof(value_group));
+		memset(list->hash->groups, 0, list->hash->capacity * sizeof(value_group));
+		list->hash->groups_used = 0;
+		list->hash->edit_capacity = MIN_KEY_EDITS;
+		list->hash->edits = (key_edit*) hash_allocate_ll(list, list->hash->edit_capacity * sizeof(key_edit));
+	}
+	list->hash->hash = hash_p;
+	list->hash->valid = 0;
+	refresh_hash_ll(list);
+	return 1;
+}
+
+void prepare_ll(linked_list *list) {
+	settle_links_ll(list);
+	refresh_prevs_ll(list);
+	refresh_skip_ll(list);
+	if (list->hash != NULL) {
+		refresh_hash_ll(list);
+	}
+}
+
+size_t get_size_ll(linked_list *list) {
+	return list->size;
+}
+
+void empty_ll(linked_list* list) {
+	node *curr = list->head;
+	node *next;
+	settle_links_ll(list);
+	list->prevs_valid = 1;
+	if (list->skip != NULL) {
+		clear_skip_ll(list);
+	} if (list->hash != NULL) {
+		reset_groups_ll(list, 0);
+		list->hash->head_key = KEY_ORIGIN;
+		list->hash->edit_count = 0;
+		list->hash->valid = 1;
+	}
+	list->finger = NULL;
+	list->version++;
+	if (list->pool != NULL && IS_ARENA(list->pool) && list->freev == free && list->pool->outside_values == 0) {
+		curr = NULL; // Values only need freeing with the arena
+		list->pool->live -= list->memory.node_bytes + list->memory.value_bytes + list->memory.overhead_bytes;
+		list->memory.node_bytes = list->memory.value_bytes = list->memory.overhead_bytes = 0;
+	}
+
+	while (curr != NULL) {
+		next = curr->next;
+		free_node_ll(list, curr);
+		curr = next;
+	}
+	list->head = list->tail = NULL;
+	list->size = 0;
+	if (list->pool != NULL && IS_ARENA(list->pool) && list->pool->refs == 1) {
+		free_slabs_ll(list->pool);
+	}
+}
+
+void free_linked_list(linked_list* list) {
+	empty_ll(list);
+	free_list_struct_ll(list);
+}
+
+int is_empty_ll(linked_list *list) {
+	if (list->head == NULL) {
+		return 1;
+	} return 0;
+}
+
+// Links new_node in after prev, or in front of the list if prev is NULL, index is where it ends up or UNKNOWN_INDEX
+static void link_after_ll(linked_list *list, node *prev, node *new_node, size_t index, skip_path *path) {
+	if (prev == NULL) {
+		new_node->next = list->head;
+		list->head = new_node;
+	} else {
+		new_node->next = prev->next;
+		prev->next = new_node;
+	} if (prev == list->tail) {
+		list->tail = new_node;
+	} if (list->deque && list->prevs_valid) {
+		PREV_NODE(list, new_node) = prev;
+		if (new_node->next != NULL) {
+			PREV_NODE(list, new_node->next) = new_node;
+		}
+	}
+	list->size++;
+	if (index == UNKNOWN_INDEX) {
+		list->finger = NULL;
+		if (list->skip != NULL) {
+			list->skip->valid = 0;
+		}
+	} else if (list->finger != NULL && index <= list->finger_index) {
+		list->finger_index++;
+	} if (index == UNKNOWN_INDEX || index + 1 < list->size) {
+		list->version++; // Appending keeps every node at its index
+	}
+	skip_insert_ll(list, path, new_node, index);
+	hash_insert_ll(list, new_node, index);
+}
+
+// Links new_head in front of the list
+static void link_head_ll(linked_list *list, node *new_head) {
+	skip_path path;
+	link_after_ll(list, node_before_ll(list, 0, &path), new_head, 0, &path);
+}
+
+// Links new_tail after the last node of the list, returns the index it got
+static size_t link_tail_ll(linked_list *list, node *new_tail) {
+	skip_path path;
+	size_t index = list->size;
+	link_after_ll(list, node_before_ll(list, index, &path), new_tail, index, &path);
+	return index;
+}
+
+// Links new_node in at index, index has to be smaller than the size of the list
+// Like insert_ll the last index links the node after the tail
+static void link_at_ll(linked_list *list, node *new_node, size_t index) {
+	skip_path path;
+	if (index == (list->size - 1)) {
+		index = list->size;
+	}
+	refresh_skip_ll(list);
+	link_after_ll(list, node_before_ll(list, index, &path), new_node, index, &path);
+}
+
+// Unlinks the node after prev, or the head if prev is NULL, and returns it without freeing it
+// index is where the node was or UNKNOWN_INDEX, path has to be filled by node_before_ll if the skip index is up to date
+static node *unlink_after_ll(linked_list *list, node *prev, size_t index, skip_path *path) {
+	node *curr = (prev == NULL) ? list->head : prev->next;
+	if (prev == NULL) {
+		list->head = curr->next;
+	} else {
+		prev->next = curr->next;
+	} if (curr == list->tail) {
+		list->tail = prev;
+	} if (list->deque && list->prevs_valid && curr->next != NULL) {
+		PREV_NODE(list, curr->next) = prev;
+	}
+	list->size--;
+	list->version++;
+	if (index == UNKNOWN_INDEX) {
+		list->finger = NULL;
+		if (list->skip != NULL) {
+			list->skip->valid = 0;
+		}
+	} else if (list->finger != NULL && index <= list->finger_index) {
+		if (index == list->finger_index) {
+			list->finger = NULL;
+		}
+		list->finger_index--;
+	}
+	skip_remove_ll(list, path, index);
+	hash_remove_ll(list, curr, index);
+	return curr;
+}
+
+// Unlinks the node at index and returns it without freeing it, index has to be smaller than the size of the list
+static node *unlink_at_ll(linked_list *list, size_t index) {
+	skip_path path;
+	if (index > 0) {
+		refresh_skip_ll(list);
+	} if (index > 0 && index + 1 == list->size) {
+		refresh_prevs_ll(list);
+	}
+	return unlink_after_ll(list, node_before_ll(list, index, &path), index, &path);
+}
+
+void prepend_ll(linked_list *list, void *data, size_t data_size) {
+	node *new_head = new_node_ll(list, data_size);
+	copy_value_ll(list, new_head->value, data, data_size, list->deep_copyv);
+	link_head_ll(list, new_head);
+}
+
+size_t append_ll(linked_list *list, void *data, size_t data_size) {
+	node *new_tail = new_node_ll(list, data_size);
+	copy_value_ll(list, new_tail->value, data, data_size, list->deep_copyv);
+	return link_tail_ll(list, new_tail);
+}
+
+int insert_ll(linked_list *list, void *data, size_t data_size, size_t index) {
+	if (index >= list->size) {
+		return 0;
+	}
+
+	node *new_node = new_node_ll(list, data_size);
+	copy_value_ll(list, new_node->value, data, data_size, list->deep_copyv);
+	link_at_ll(list, new_node, index);
+	return 1;
+}
+
+void prepend_adopt_ll(linked_list *list, void *data, size_t data_size) {
+	link_head_ll(list, adopt_node_ll(list, data, data_size));
+}
+
+size_t append_adopt_ll(linked_list *list, void *data, size_t data_size) {
+	return link_tail_ll(list, adopt_node_ll(list, data, data_size));
+}
+
+int insert_adopt_ll(linked_list *list, void *data, size_t data_size, size_t index) {
+	if (index >= list->size) {
+		return 0;
+	}
+
+	link_at_ll(list, adopt_node_ll(list, data, data_size), index);
+	return 1;
+}
+
+// Makes count linked nodes holding copies of the values in buffer and returns the first, last gets the last node
+// Pooled and arena lists use released slots first, then what is left of the newest slab, and carve the rest as one
+// block. Heap lists allocate node by node, their nodes are freed one at a time so they can not share a block
+static node *batch_nodes_ll(linked_list *list, const void *buffer, size_t count, size_t elem_size, node **last) {
+	size_t value_size = list->elem_size ? list->elem_size : elem_size;
+	int carves = list->pool != NULL && (IS_ARENA(list->pool) || value_size <= list->pool->slot_size - PAYLOAD_OFFSET(list));
+	size_t node_size = (list->pool == NULL) ? 0 : IS_ARENA(list->pool) ? ALIGN_UP(PAYLOAD_OFFSET(list) + value_size) : list->pool->slot_size;
+	size_t from_block = count;
+	size_t from_slab = 0;
+	char *slab_part = NULL;
+	char *block = NULL;
+	node *first = NULL;
+	node *prev = NULL;
+	node *curr;
+
+	if (carves) {
+		for (node *reused = list->pool->free_nodes; reused != NULL && from_block > 0; reused = reused->next) {
+			from_block--; // Released slots are used up before the block
+		}
+		from_slab = list->pool->slab_left / node_size; // The newest slab is used up before a new one is opened
+		if (from_slab > from_block) {
+			from_slab = from_block;
+		}
+		from_block -= from_slab;
+		slab_part = (from_slab > 0) ? (char*) carve_ll(list->pool, from_slab * node_size) : NULL;
+		block = (from_block > 0) ? (char*) carve_ll(list->pool, from_block * node_size) : NULL;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (!carves) {
+			curr = new_node_ll(list, value_size);
+		} else {
+			if (list->pool->free_nodes != NULL) {
+				curr = list->pool->free_nodes;
+				list->pool->free_nodes = curr->next;
+			} else if (from_slab > 0) {
+				curr = (node*) slab_part;
+				slab_part += node_size;
+				from_slab--;
+			} else {
+				curr = (node*) block;
+				block += node_size;
+			}
+			curr->value = (char*) curr + PAYLOAD_OFFSET(list);
+			if (!list->elem_size) {
+				((sized_node*) curr)->val_size = value_size;
+			}
+			list->pool->live += node_footprint_ll(list, curr);
+			STAMP_NODE(curr);
+			count_node_ll(list, curr, 1);
+		}
+		copy_value_ll(list, curr->value, (const char*) buffer + i * elem_size, value_size, list->deep_copyv);
+
+		if (prev == NULL) {
+			first = curr;
+		} else {
+			prev->next = curr;
+		} if (list->deque) {
+			PREV_NODE(list, curr) = prev;
+		}
+		prev = curr;
+	}
+	prev->next = NULL;
+	*last = prev;
+	return first;
+}
+
+// Prints a message and returns 0 if the batch can not be added to the list
+static int check_batch_ll(linked_list *list, const void *buffer, size_t count, size_t elem_size, const char *function_name) {
+	if (buffer == NULL || count == 0) {
+		return 0;
+	} if (list->elem_size && elem_size != list->elem_size) {
+		printf("Called %s with an element size of %zu on a linked list with fixed element size %zu!\n", function_name, elem_size, list->elem_size);
+		return 0;
+	}
+	return 1;
+}
+
+size_t append_many_ll(linked_list *list, const void *buffer, size_t count, size_t elem_size) {
+	if (!check_batch_ll(list, buffer, count, elem_size, "append_many_ll")) {
+		return 0;
+	}
+	settle_links_ll(list);
+
+	node *last;
+	node *first = batch_nodes_ll(list, buffer, count, elem_size, &last);
+	size_t old_size = list->size;
+	if (list->head == NULL) {
+		list->head = first;
+	} else {
+		list->tail->next = first;
+		if (list->deque) {
+			PREV_NODE(list, first) = list->tail;
+		}
+	}
+	list->tail = last;
+	list->size += count;
+
+	if (list->skip != NULL) {
+		list->skip->valid = 0;
+	} if (list->hash != NULL && list->hash->valid) {
+		size_t key = list->hash->head_key + old_size;
+		for (node *curr = first; curr != NULL; curr = curr->next) {
+			add_occurrence_ll(list, curr, key++, PLACE_LAST);
+		}
+	}
+	return count;
+}
+
+size_t prepend_many_ll(linked_list *list, const void *buffer, size_t count, size_t elem_size) {
+	if (!check_batch_ll(list, buffer, count, elem_size, "prepend_many_ll")) {
+		return 0;
+	}
+	settle_links_ll(list);
+
+	node *last;
+	node *first = batch_nodes_ll(list, buffer, count, elem_size, &last);
+	last->next = list->head;
+	if (list->head == NULL) {
+		list->tail = last;
+	} else if (list->deque) {
+		PREV_NODE(list, list->head) = last;
+	}
+	list->head = first;
+	list->size += count;
+
+	list->finger_index += count;
+	list->version++;
+	if (list->skip != NULL) {
+		list->skip->valid = 0;
+	} if (list->hash != NULL && list->hash->valid) {
+		// Walked backwards through the keys so every node goes in front of the equal values after it
+		node **batch = (node**) malloc (count * sizeof(node *));
+		size_t i = 0;
+		for (node *curr = first; i < count; curr = curr->next) {
+			batch[i++] = curr;
+		}
+		while (i-- > 0) {
+			add_occurrence_ll(list, batch[i], --list->hash->head_key, PLACE_FIRST);
+		}
+		free(batch);
+	}
+	return count;
+}
+
+static ll_handle handle_of_ll(node *target) {
+	ll_handle handle = {target, (target != NULL) ? NODE_GENERATION(target) : 0};
+	return handle;
+}
+
+// Returns 0 and prints a message if the node of the handle was removed since the handle was made
+// Only catches anything when built with LL_DEBUG_HANDLES
+static int check_handle_ll(ll_handle handle, const char *function_name) {
+	if (handle.target != NULL && NODE_GENERATION((node*) handle.target) != handle.generation) {
+		printf("Called %s with a handle to a node that is no longer in a linked list!\n", function_name);
+		return 0;
+	}
+	(void) function_name;
+	return 1;
+}
+
+ll_handle prepend_handle_ll(linked_list *list, void *data, size_t data_size) {
+	prepend_ll(list, data, data_size);
+	return handle_of_ll(list->head);
+}
+
+ll_handle append_handle_ll(linked_list *list, void *data, size_t data_size) {
+	append_ll(list, data, data_size);
+	return handle_of_ll(list->tail);
+}
+
+ll_handle insert_handle_ll(linked_list *list, void *data, size_t data_size, size_t index) {
+	if (index >= list->size) {
+		return handle_of_ll(NULL);
+	}
+
+	node *new_node = new_node_ll(list, data_size);
+	copy_value_ll(list, new_node->value, data, data_size, list->deep_copyv);
+	link_at_ll(list, new_node, index);
+	return handle_of_ll(new_node);
+}
+
+ll_handle head_handle_ll(linked_list *list) {
+	return handle_of_ll(list->head);
+}
+
+ll_handle tail_handle_ll(linked_list *list) {
+	return handle_of_ll(list->tail);
+}
+
+ll_handle next_handle_ll(linked_list *list, ll_handle handle) {
+	if (handle.target == NULL || !check_handle_ll(handle, "next_handle_ll")) {
+		return handle_of_ll(NULL);
+	}
+	return handle_of_ll(NEXT_NODE(list, (node*) handle.target));
+}
+
+// Returns the node before target, O(1) for deque lists else a walk from the head
+static node *prev_node_ll(linked_list *list, node *target) {
+	if (list->deque && list->prevs_valid) {
+		return list->flipped ? target->next : PREV_NODE(list, target);
+	}
+
+	node *prev = NULL;
+	for (node *curr = list->head; curr != target; curr = NEXT_NODE(list, curr)) {
+		prev = curr;
+	}
+	return prev;
+}
+
+ll_handle prev_handle_ll(linked_list *list, ll_handle handle) {
+	if (handle.target == NULL || !check_handle_ll(handle, "prev_handle_ll")) {
+		return handle_of_ll(NULL);
+	}
+	return handle_of_ll(prev_node_ll(list, (node*) handle.target));
+}
+
+void *get_handle_data_ll(ll_handle handle) {
+	if (handle.target == NULL || !check_handle_ll(handle, "get_handle_data_ll")) {
+		return NULL;
+	}
+	return ((node*) handle.target)->value;
+}
+
+// Returns the index of target if it is known without walking the list, else UNKNOWN_INDEX
+// Looks at the ends, the fingers, the node after the finger and the key of the node in the hash index if it is up to
+// date. Only call it after settle_links_ll
+static size_t known_index_ll(linked_list *list, node *target) {
+	read_finger *finger = &read_finger_ll;
+	if (target == list->head) {
+		return 0;
+	} if (target == list->tail) {
+		return list->size - 1;
+	} if (list->finger != NULL && (target == list->finger || target == list->finger->next)) {
+		return list->finger_index + (target != list->finger);
+	} if (finger->list_id == list->id && finger->version == list->version && finger->target == target) {
+		return finger->index;
+	} if (list->hash == NULL || !list->hash->valid) {
+		return UNKNOWN_INDEX;
+	}
+
+	value_group *group = find_group_ll(list, target->value, list->hash->hash(target->value));
+	for (size_t i = 0; i < group->count; i++) {
+		if (group->occurrences[i].target == target) {
+			return current_key_ll(list->hash, &group->occurrences[i]) - list->hash->head_key;
+		}
+	}
+	return UNKNOWN_INDEX;
+}
+
+ll_handle insert_after_ll(linked_list *list, ll_handle handle, void *data, size_t data_size) {
+	node *prev = (node*) handle.target;
+	if (!check_handle_ll(handle, "insert_after_ll")) {
+		return handle_of_ll(NULL);
+	} if (prev == NULL || prev == list->tail) {
+		return (prev == NULL) ? prepend_handle_ll(list, data, data_size) : append_handle_ll(list, data, data_size);
+	}
+	settle_links_ll(list);
+
+	// When the index of prev is known the indexes are updated in place and the finger is left on the new node so
+	// inserting after it again is known too, else the positions of the indexes go out of date
+	skip_path path;
+	size_t index = known_index_ll(list, prev);
+	if (index != UNKNOWN_INDEX && list->skip != NULL && list->skip->valid) {
+		node_before_ll(list, index + 1, &path); // Only fills path, the node before is prev
+	}
+	node *new_node = new_node_ll(list, data_size);
+	copy_value_ll(list, new_node->value, data, data_size, list->deep_copyv);
+	if (index == UNKNOWN_INDEX) {
+		link_after_ll(list, prev, new_node, UNKNOWN_INDEX, &path);
+	} else {
+		link_after_ll(list, prev, new_node, index + 1, &path);
+		list->finger = new_node;
+		list->finger_index = index + 1;
+	}
+	return handle_of_ll(new_node);
+}
+
+int erase_after_ll(linked_list *list, ll_handle handle) {
+	node *prev = (node*) handle.target;
+	settle_links_ll(list);
+	if (!check_handle_ll(handle, "erase_after_ll") || list->head == NULL || (prev != NULL && prev->next == NULL)) {
+		return 0;
+	} if (prev == NULL) {
+		free_node_ll(list, unlink_at_ll(list, 0));
+		return 1;
+	}
+
+	skip_path path;
+	size_t index = known_index_ll(list, prev);
+	if (index != UNKNOWN_INDEX) {
+		index++;
+	} else if (prev->next == list->tail) {
+		index = list->size - 1;
+	} if (index != UNKNOWN_INDEX && list->skip != NULL && list->skip->valid) {
+		node_before_ll(list, index, &path); // Only fills path, the node before is prev
+	}
+	free_node_ll(list, unlink_after_ll(list, prev, index, &path));
+	return 1;
+}
+
+int remove_handle_ll(linked_list *list, ll_handle handle) {
+	if (handle.target == NULL || !check_handle_ll(handle, "remove_handle_ll")) {
+		return 0;
+	}
+	settle_links_ll(list);
+	refresh_prevs_ll(list);
+	return erase_after_ll(list, handle_of_ll(prev_node_ll(list, (node*) handle.target)));
+}
+
+int delete_ll(linked_list *list, size_t index) {
+	if (list->head == NULL || index >= list->size) {
+		return 0;
+	}
+
+	free_node_ll(list, unlink_at_ll(list, index));
+	return 1;
+}
+
+void *extract_head_ll(linked_list *list) {
+	if (list->head == NULL) {
+		return NULL;
+	}
+
+	return take_value_ll(list, unlink_at_ll(list, 0));
+}
+
+int extract_head_into_ll(linked_list *list, void *destination) {
+	if (list->head == NULL) {
+		return 0;
+	}
+
+	node *old_head = unlink_at_ll(list, 0);
+	copy_value_ll(list, destination, old_head->value, VAL_SIZE(list, old_head), memcpy);
+	count_node_ll(list, old_head, -1);
+	if (!list->co_allocate || !VALUE_IS_INLINE(list, old_head)) {
+		free_outside_value_ll(list, old_head);
+	}
+	release_node_ll(list, old_head);
+	return 1;
+}
+
+void *extract_ll(linked_list *list, size_t index) {
+	if (list->head == NULL || index >= list->size) {
+		return NULL;
+	}
+
+	return take_value_ll(list, unlink_at_ll(list, index));
+}
+
+void *extract_tail_ll(linked_list *list) {
+	if (list->head == NULL) {
+		return NULL;
+	}
+
+	return take_value_ll(list, unlink_at_ll(list, list->size - 1));
+}
+
+void print_ll(linked_list *list) {
+	if (list->printv == NULL) {
+		printf("Attempted to call print_ll without giving the linked list a print function!\nYou can do so by set_print_ll\n");
+		return;
+	}
+	node *curr = list->head;
+	size_t index = 0;
+	printf("\n----- ----- Linked List Start ----- -----\n");
+
+	while (curr != NULL) {
+		printf("Index: %zu ", index);
+		list->printv(curr->value);
+		curr = NEXT_NODE(list, curr);
+		index++;
+	}
+
+	printf("\n----- ----- Linked List |End| ----- -----\n");
+}
+
+linked_list *clone_linked_list(linked_list *list, void *(*allocator_p)(size_t)) {
+	linked_list *cloned_list = new_linked_list((allocator_p) ? allocator_p :list->allocate);
+	cloned_list->size = list->size;
+	cloned_list->printv = list->printv;
+	cloned_list->freev = list->freev;
+	cloned_list->deep_copyv = list->deep_copyv;
+	cloned_list->compare = list->compare;
+	share_storage_ll(cloned_list, list, allocator_p != NULL);
+
+	if (is_empty_ll(list)) {
+		return cloned_list;
+	}
+
+	cloned_list->head = new_node_ll(cloned_list, VAL_SIZE(list, list->head));
+	copy_value_ll(list, cloned_list->head->value, list->head->value, VAL_SIZE(list, list->head), list->deep_copyv);
+
+	node *clone_curr = cloned_list->head;
+	node *curr = list->head;
+
+	if (curr == list->tail) {
+		cloned_list->head->next = NULL;
+		cloned_list->tail = cloned_list->head;
+		return cloned_list;
+	}
+
+	curr = NEXT_NODE(list, curr);
+
+	while (curr != NULL) {
+		clone_curr->next = new_node_ll(cloned_list, VAL_SIZE(list, curr));
+		clone_curr = clone_curr->next;
+		copy_value_ll(list, clone_curr->value, curr->value, VAL_SIZE(list, curr), list->deep_copyv);
+		curr = NEXT_NODE(list, curr);
+	}
+
+	cloned_list->tail = clone_curr;
+	cloned_list->tail->next = NULL;
+	return cloned_list;
+}
+
+void reverse_ll(linked_list *list) {
+	if (is_empty_ll(list) || list->head == list->tail) {
+		return;
+	} if (list->deque) {
+		refresh_prevs_ll(list);
+		list->flipped = !list->flipped;
+		node *old_head = list->head;
+		list->head = list->tail;
+		list->tail = old_head;
+		list->finger = NULL;
+		list->version++;
+		if (list->skip != NULL) {
+			list->skip->valid = 0;
+		} if (list->hash != NULL) {
+			list->hash->valid = 0;
+		}
+		refresh_indexes_ll(list); // Settles the links, so the reverse is only O(1) without an index
+		return;
+	}
+	invalidate_positions_ll(list);
+
+	node *prev = list->head;
+	node *curr = list->head->next;
+	node *next = list->head->next->next;
+	list->head->next = NULL;
+
+	while (next != NULL) {
+		curr->next = prev;
+		prev = curr;
+		curr = next;
+		next = next->next;
+	}
+
+	curr->next = prev;
+	node *temp = list->head;
+	list->head = list->tail;
+	list->tail = temp;
+	refresh_indexes_ll(list);
+}
+
+void *get_data_ll(linked_list *list, size_t index) {
+	if (index >= list->size || is_empty_ll(list)) {
+		return NULL;
+	}
+
+	if (index == list->size - 1) {
+		return list->tail->value;
+	}
+	
+	return node_at_ll(list, index)->value;
+}
+
+void map_ll(linked_list *list, void (*func)(void *)) {
+	node *curr = list->head;
+	while (curr != NULL) {
+		func(curr->value);
+		curr = NEXT_NODE(list, curr);
+	}
+}
+
+void filter_ll(linked_list *list, int (*func)(void *)) { // func should return 1 if the value should be removed else 0
+	if (is_empty_ll(list)) {
+		return;
+	}
+
+	if (func == NULL) {
+		printf("Attempted to filter linked list when the filter function is NULL?\n");
+		return;
+	}
+	invalidate_positions_ll(list);
+
+	node *prev = list->head;
+	node *curr = list->head->next;
+
+	while (func(prev->value)) {
+		free_node_ll(list, prev);
+		list->size--;
+		if (curr != NULL) {
+			prev = curr;
+			curr = curr->next;
+		} else {
+			list->head = NULL;
+			list->tail = NULL;
+			refresh_indexes_ll(list);
+			return;
+		}
+	}
+
+	list->head = prev;
+
+	while (curr != NULL) {
+		if (func(curr->value)) {
+			prev->next = curr->next;
+			free_node_ll(list, curr);
+			list->size--;
+		} else {
+			prev = curr;
+		}
+		curr = prev->next;
+	}
+
+	list->tail = prev;
+	list->tail->next = NULL;
+	refresh_indexes_ll(list);
+}
+
+static int compare_index_ll(const void *a, const void *b) {
+	size_t first = *(const size_t*) a;
+	size_t second = *(const size_t*) b;
+	return (first > second) - (first < second);
+}
+
+// Unlinks the nodes at the given indexes in one walk, duplicates and indexes out of range are skipped
+// The values are freed, or handed out in index order through values if it is not NULL. Returns the amount removed
+static size_t remove_many_ll(linked_list *list, const size_t *indexes, size_t count, void **values) {
+	size_t *sorted = NULL;
+	size_t i;
+	for (i = 1; i < count; i++) {
+		if (indexes[i] < indexes[i - 1]) {
+			sorted = (size_t*) malloc (count * sizeof(size_t));
+			memcpy(sorted, indexes, count * sizeof(size_t));
+			qsort(sorted, count, sizeof(size_t), compare_index_ll);
+			indexes = sorted;
+			break;
+		}
+	}
+	if (count == 0 || list->head == NULL) {
+		free(sorted);
+		return 0;
+	}
+	invalidate_positions_ll(list);
+
+	node *prev = NULL;
+	node *curr = list->head;
+	node *next;
+	size_t curr_index = 0;
+	size_t removed = 0;
+	for (i = 0; i < count && indexes[i] < list->size; i++) {
+		if (i > 0 && indexes[i] == indexes[i - 1]) {
+			continue;
+		}
+		while (curr_index < indexes[i]) {
+			prev = curr;
+			curr = curr->next;
+			curr_index++;
+		}
+
+		next = curr->next;
+		if (prev == NULL) {
+			list->head = next;
+		} else {
+			prev->next = next;
+		} if (values != NULL) {
+			values[removed] = take_value_ll(list, curr);
+		} else {
+			free_node_ll(list, curr);
+		}
+		removed++;
+		curr = next;
+		curr_index++;
+	}
+
+	if (curr == NULL) {
+		list->tail = prev;
+	}
+	list->size -= removed;
+	refresh_indexes_ll(list);
+	free(sorted);
+	return removed;
+}
+
+size_t delete_many_ll(linked_list *list, const size_t *indexes, size_t count) {
+	return remove_many_ll(list, indexes, count, NULL);
+}
+
+void **extract_many_ll(linked_list *list, const size_t *indexes, size_t count, size_t *extracted) {
+	void **values = malloc (((count > 0) ? count : 1) * sizeof(void *));
+	size_t removed = remove_many_ll(list, indexes, count, values);
+	if (extracted != NULL) {
+		*extracted = removed;
+	}
+	return values;
+}
+
+void *iter_ll(linked_list *new_linked_list) {
+	static ll_cursor cursor = {NULL, NULL, NULL};
+	if (new_linked_list == NULL) {
+		return (cursor.list == NULL) ? NULL : cursor_next_ll(&cursor);
+	}
+
+	cursor = cursor_begin_ll(new_linked_list);
+	return NULL;
+}
+
+ll_cursor cursor_begin_ll(linked_list *list) {
+	ll_cursor cursor = {list, NULL, NULL};
+	return cursor;
+}
+
+// The node after the current one, or the head while the cursor is before the first node or its current node was the head and removed
+static node *cursor_following_ll(ll_cursor *cursor) {
+	if (cursor->curr != NULL) {
+		return NEXT_NODE(cursor->list, (node*) cursor->curr);
+	}
+	return (cursor->prev == NULL) ? cursor->list->head : NEXT_NODE(cursor->list, (node*) cursor->prev);
+}
+
+void *cursor_next_ll(ll_cursor *cursor) {
+	node *next = cursor_following_ll(cursor);
+	if (cursor->curr != NULL) {
+		cursor->prev = cursor->curr;
+	}
+	cursor->curr = next;
+	return (next == NULL) ? NULL : next->value;
+}
+
+void *cursor_peek_ll(ll_cursor *cursor) {
+	node *next = cursor_following_ll(cursor);
+	return (next == NULL) ? NULL : next->value;
+}
+
+int cursor_remove_ll(ll_cursor *cursor) {
+	if (cursor->curr == NULL) {
+		return 0;
+	}
+
+	// The node before the current one is known so this is the O(1) erase_after_ll
+	erase_after_ll(cursor->list, handle_of_ll((node*) cursor->prev));
+	cursor->curr = NULL;
+	return 1;
+}
+
+linked_list *slice_linked_list(linked_list* list, size_t start, size_t end, void *(*allocator_p)(size_t)) {
+	if (end < start) {
+		printf("Start index cannot be greater than end index...\n");
+		return NULL;
+	} else if (end >= list->size || is_empty_ll(list)) {
+		return NULL; // No message here
+	}
+
+	linked_list *new_list = new_linked_list((allocator_p) ? allocator_p : list->allocate);
+	new_list->printv = list->printv;
+	new_list->freev = list->freev;
+	new_list->deep_copyv = list->deep_copyv;
+	new_list->compare = list->compare;
+	share_storage_ll(new_list, list, allocator_p != NULL);
+	new_list->size = end - start + 1;
+
+	node *curr = node_at_ll(list, start);
+	size_t cur_index = start;
+
+	new_list->head = new_node_ll(new_list, VAL_SIZE(list, curr));
+	copy_value_ll(list, new_list->head->value, curr->value, VAL_SIZE(list, curr), list->deep_copyv);
+	node *new_curr = new_list->head;
+	
+	while (cur_index < end) {
+		curr = NEXT_NODE(list, curr);
+		new_curr->next = new_node_ll(new_list, VAL_SIZE(list, curr));
+		new_curr = new_curr->next;
+		copy_value_ll(list, new_curr->value, curr->value, VAL_SIZE(list, curr), list->deep_copyv);
+		cur_index++;
+	}
+
+	new_list->tail = new_curr;
+	new_list->tail->next = NULL;
+
+	return new_list;
+}
+
+linked_list *seperate_linked_list(linked_list *list, int(*func)(void *), void *(*allocator_p)(size_t)) { // func should return 1 if going in seperated list else 0
+	linked_list *new_list = new_linked_list((allocator_p) ? allocator_p : list->allocate);
+	new_list->printv = list->printv;
+	new_list->freev = list->freev;
+	new_list->deep_copyv = list->deep_copyv;
+	new_list->compare = list->compare;
+	share_storage_ll(new_list, list, 0); // Moved nodes stay in the storage they were allocated from
+	new_list->size = 0;
+
+	if (list == NULL || list->head == NULL) {
+		return new_list;
+	}
+	invalidate_positions_ll(list);
+
+	node *new_curr = new_list->head;
+	node *prev = NULL;
+	node *curr = list->head;
+	node *next = NULL;
+
+	while (curr != NULL) {
+		next = curr->next;
+
+		if (func(curr->value)) {
+			if (new_curr == NULL) {
+				new_list->head = new_curr = curr;
+			} else {
+				new_curr->next = curr;
+				new_curr = curr;
+			}
+
+			if (prev == NULL) {
+				list->head = next;
+			} else {
+				prev->next = next;
+			}
+
+			count_node_ll(list, curr, -1);
+			count_node_ll(new_list, curr, 1);
+			new_list->size++;
+			list->size--;
+		} else {
+			prev = curr;
+		}
+		curr = next;
+	}
+	
+	list->tail = prev;
+	if (prev != NULL) {
+		prev->next = NULL;
+	}
+	new_list->tail = new_curr;
+	if (new_curr != NULL) {
+		new_curr->next = NULL;
+	}
+	refresh_indexes_ll(list);
+
+	return new_list;
+}
+
+void merge_sort_ll(linked_list *list) {
+	if (list->size <= 1) { // The raw next of the head is NULL while a reversed deque list is flipped
+		return;
+	}
+
+	if (list->compare == NULL) {
+		printf("Called merge_sort_ll without giving the linked list a compare function?!\nSet it by set_compare_ll\n");
+		return;
+	}
+	invalidate_positions_ll(list);
+
+	node** nodes = (node **) malloc (list->size * sizeof(node *));
+	node** next_nodes = (node **) malloc (list->size * sizeof(node *));
+	node** temp_nodes;
+	size_t i;
+	node* curr = list->head;
+
+	for (i = 0; i < list->size; i++) {
+		nodes[i] = curr;
+		curr = curr->next;
+	}
+
+	curr = nodes[0];
+	size_t endi;
+	size_t endj;
+	size_t j;
+	int icontinue;
+	int jcontinue;
+	int isi;
+	size_t subsize = 1;
+	size_t subsize2;
+	size_t k;
+
+	while (subsize < list->size) {
+		i = k = 0;
+		j = endi = subsize;
+		subsize2 = subsize << 1;
+		endj = (list->size > subsize2) ? subsize2 : list->size;
+		jcontinue = (j < endj);
+		icontinue = (i < endi);
+		while (i < list->size) {
+			while (icontinue || jcontinue) {
+				if (icontinue && jcontinue) {
+					if (list->compare(nodes[i]->value, nodes[j]->value) >= 0) {
+						isi = 1;
+					} else {
+						isi = 0;
+					}
+				} else {
+					if (icontinue) {
+						isi = 1;
+					} else {
+						isi = 0;
+					}
+				}
+				if (isi) {
+					next_nodes[k++] = nodes[i++];
+					icontinue = (i < endi);
+				} else {
+					next_nodes[k++] = nodes[j++];
+					jcontinue = (j < endj);
+				}
+			}
+			i = endj;
+			subsize2 = i + subsize;
+			j = endi = (list->size > subsize2) ? subsize2 : list->size;
+			subsize2 = j + subsize;
+			endj = (list->size > subsize2) ? subsize2 : list->size;
+			jcontinue = (j < endj);
+			icontinue = (i < endi);
+		}
+		temp_nodes = nodes;
+		nodes = next_nodes;
+		next_nodes = temp_nodes;
+		subsize <<= 1;
+	}
+
+	for (i = 1; i < list->size; i++) {
+		nodes[i - 1]->next = nodes[i];
+	}
+
+	list->head = nodes[0];
+	list->tail = nodes[list->size - 1];
+	list->tail->next = NULL;
+	refresh_indexes_ll(list);
+	free(nodes);
+	free(next_nodes);
+}
+
+// Part of parallel_merge_sort_ll done by one thread, either sorting nodes[0, count) or writing the outputs
+// first to last of merging the sorted runs a and b into out
+typedef struct sort_job {
+	int (*compare)(const void *a, const void *b);
+	node **nodes;
+	node **temp_nodes;
+	size_t count;
+	node **a;
+	size_t a_count;
+	node **b;
+	size_t b_count;
+	node **out;
+	size_t first;
+	size_t last;
+} sort_job;
+
+// Merges a and b into out the same way merge_sort_ll does, the value of a goes first unless the one of b is bigger
+static void merge_runs_ll(int (*compare)(const void *, const void *), node **a, size_t a_count, node **b, size_t b_count, node **out) {
+	size_t i = 0;
+	size_t j = 0;
+	while (i < a_count && j < b_count) {
+		*out++ = (compare(a[i]->value, b[j]->value) >= 0) ? a[i++] : b[j++];
+	}
+	memcpy(out, a + i, (a_count - i) * sizeof(node *));
+	memcpy(out + a_count - i, b + j, (b_count - j) * sizeof(node *));
+}
+
+// Number of nodes taken from a for the first diagonal outputs of merging a and b (merge path)
+static size_t merge_split_ll(int (*compare)(const void *, const void *), node **a, size_t a_count, node **b, size_t b_count, size_t diagonal) {
+	size_t low = (diagonal > b_count) ? diagonal - b_count : 0;
+	size_t high = (diagonal < a_count) ? diagonal : a_count;
+	while (low < high) {
+		size_t mid = low + (high - low) / 2;
+		if (compare(a[mid]->value, b[diagonal - mid - 1]->value) >= 0) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+	return low;
+}
+
+static void *run_sort_job_ll(void *arg) {
+	sort_job *job = (sort_job*) arg;
+	if (job->out == NULL) {
+		// Bottom up merge sort of the chunk, the result is copied back if it ends up in temp_nodes
+		node **from = job->nodes;
+		node **to = job->temp_nodes;
+		node **swap;
+		for (size_t width = 1; width < job->count; width <<= 1) {
+			for (size_t low = 0; low < job->count; low += width << 1) {
+				size_t mid = (low + width < job->count) ? low + width : job->count;
+				size_t high = (mid + width < job->count) ? mid + width : job->count;
+				merge_runs_ll(job->compare, from + low, mid - low, from + mid, high - mid, to + low);
+			}
+			swap = from;
+			from = to;
+			to = swap;
+		}
+		if (from != job->nodes) {
+			memcpy(job->nodes, from, job->count * sizeof(node *));
+		}
+		return NULL;
+	}
+
+	size_t a_first = merge_split_ll(job->compare, job->a, job->a_count, job->b, job->b_count, job->first);
+	size_t a_last = merge_split_ll(job->compare, job->a, job->a_count, job->b, job->b_count, job->last);
+	merge_runs_ll(job->compare, job->a + a_first, a_last - a_first, job->b + job->first - a_first, (job->last - a_last) - (job->first - a_first), job->out + job->first);
+	return NULL;
+}
+
+// Threads made once per parallel_merge_sort_ll that take the jobs of every round, the calling thread takes jobs too
+// so a round also finishes when no thread could be made
+typedef struct sort_workers {
+	pthread_mutex_t lock;
+	pthread_cond_t start; // Signalled when a round of jobs is handed out or the workers have to stop
+	pthread_cond_t finish; // Signalled when the last job of the round is done
+	pthread_t *threads;
+	size_t thread_count; // Threads that were made
+	sort_job *jobs;
+	size_t job_count;
+	size_t next_job; // First job of the round no thread has taken yet
+	size_t done_jobs;
+	size_t round; // Rounds handed out so far, a worker waits until it changes
+	int stop;
+} sort_workers;
+
+// Runs jobs of the current round until none are left to take, the lock is held when called and when it returns
+static void take_sort_jobs_ll(sort_workers *workers) {
+	while (workers->next_job < workers->job_count) {
+		sort_job *job = &workers->jobs[workers->next_job++];
+		pthread_mutex_unlock(&workers->lock);
+		run_sort_job_ll(job);
+		pthread_mutex_lock(&workers->lock);
+		if (++workers->done_jobs == workers->job_count) {
+			pthread_cond_signal(&workers->finish);
+		}
+	}
+}
+
+static void *sort_worker_ll(void *arg) {
+	sort_workers *workers = (sort_workers*) arg;
+	size_t seen = 0;
+	pthread_mutex_lock(&workers->lock);
+	while (1) {
+		while (workers->round == seen && !workers->stop) {
+			pthread_cond_wait(&workers->start, &workers->lock);
+		} if (workers->stop) {
+			break;
+		}
+		seen = workers->round;
+		take_sort_jobs_ll(workers);
+	}
+	pthread_mutex_unlock(&workers->lock);
+	return NULL;
+}
+
+// Makes up to thread_count - 1 workers, the calling thread is the last one
+static void start_sort_workers_ll(sort_workers *workers, size_t thread_count) {
+	pthread_mutex_init(&workers->lock, NULL);
+	pthread_cond_init(&workers->start, NULL);
+	pthread_cond_init(&workers->finish, NULL);
+	workers->jobs = NULL;
+	workers->job_count = workers->next_job = workers->done_jobs = 0;
+	workers->round = 0;
+	workers->stop = 0;
+	workers->threads = (pthread_t*) malloc ((thread_count - 1) * sizeof(pthread_t));
+	workers->thread_count = 0;
+	for (size_t i = 1; i < thread_count; i++) {
+		if (pthread_create(&workers->threads[workers->thread_count], NULL, sort_worker_ll, workers) == 0) {
+			workers->thread_count++;
+		}
+	}
+}
+
+static void stop_sort_workers_ll(sort_workers *workers) {
+	pthread_mutex_lock(&workers->lock);
+	workers->stop = 1;
+	pthread_cond_broadcast(&workers->start);
+	pthread_mutex_unlock(&workers->lock);
+	for (size_t i = 0; i < workers->thread_count; i++) {
+		pthread_join(workers->threads[i], NULL);
+	}
+	free(workers->threads);
+	pthread_mutex_destroy(&workers->lock);
+	pthread_cond_destroy(&workers->start);
+	pthread_cond_destroy(&workers->finish);
+}
+
+// Hands the jobs out to the workers and runs some of them too, returns when every job is done
+static void run_sort_jobs_ll(sort_workers *workers, sort_job *jobs, size_t job_count) {
+	pthread_mutex_lock(&workers->lock);
+	workers->jobs = jobs;
+	workers->job_count = job_count;
+	workers->next_job = 0;
+	workers->done_jobs = 0;
+	workers->round++;
+	pthread_cond_broadcast(&workers->start);
+	take_sort_jobs_ll(workers);
+	while (workers->done_jobs < workers->job_count) {
+		pthread_cond_wait(&workers->finish, &workers->lock);
+	}
+	pthread_mutex_unlock(&workers->lock);
+}
+
+void parallel_merge_sort_ll(linked_list *list, size_t thread_count) {
+	if (list->size <= 1) {
+		return;
+	}
+
+	if (list->compare == NULL) {
+		printf("Called parallel_merge_sort_ll without giving the linked list a compare function?!\nSet it by set_compare_ll\n");
+		return;
+	}
+	if (thread_count == 0) {
+		long online = sysconf(_SC_NPROCESSORS_ONLN);
+		thread_count = (online > 0) ? (size_t) online : 1;
+	} if (thread_count > list->size / PARALLEL_SORT_MIN_CHUNK) {
+		thread_count = list->size / PARALLEL_SORT_MIN_CHUNK;
+	} if (thread_count < 2) {
+		merge_sort_ll(list);
+		return;
+	}
+	invalidate_positions_ll(list);
+
+	node **nodes = (node **) malloc (list->size * sizeof(node *));
+	node **next_nodes = (node **) malloc (list->size * sizeof(node *));
+	node **temp_nodes;
+	sort_job *jobs = (sort_job*) calloc (thread_count, sizeof(sort_job));
+	size_t *run_starts = (size_t*) malloc ((thread_count + 1) * sizeof(size_t));
+	size_t run_count = thread_count;
+	size_t i = 0;
+	sort_workers workers;
+	for (node *curr = list->head; curr != NULL; curr = curr->next) {
+		nodes[i++] = curr;
+	}
+	start_sort_workers_ll(&workers, thread_count);
+
+	// Every thread sorts a chunk of about the same size
+	for (i = 0; i <= run_count; i++) {
+		run_starts[i] = list->size / run_count * i + ((list->size % run_count < i) ? list->size % run_count : i);
+	}
+	for (i = 0; i < run_count; i++) {
+		jobs[i].compare = list->compare;
+		jobs[i].nodes = nodes + run_starts[i];
+		jobs[i].temp_nodes = next_nodes + run_starts[i];
+		jobs[i].count = run_starts[i + 1] - run_starts[i];
+	}
+	run_sort_jobs_ll(&workers, jobs, run_count);
+
+	// Neighbouring runs are merged in pairs, the threads are spread over the pairs and split the outputs along merge paths
+	while (run_count > 1) {
+		size_t pairs = run_count / 2;
+		size_t parts = thread_count / pairs;
+		size_t job_count = 0;
+		for (size_t pair = 0; pair < pairs; pair++) {
+			size_t a_start = run_starts[2 * pair];
+			size_t b_start = run_starts[2 * pair + 1];
+			size_t b_end = run_starts[2 * pair + 2];
+			for (size_t part = 0; part < parts; part++) {
+				sort_job *job = &jobs[job_count++];
+				job->compare = list->compare;
+				job->a = nodes + a_start;
+				job->a_count = b_start - a_start;
+				job->b = nodes + b_start;
+				job->b_count = b_end - b_start;
+				job->out = next_nodes + a_start;
+				job->first = (b_end - a_start) * part / parts;
+				job->last = (b_end - a_start) * (part + 1) / parts;
+			}
+		}
+		run_sort_jobs_ll(&workers, jobs, job_count);
+
+		if (run_count % 2) { // The last run has no partner this round
+			memcpy(next_nodes + run_starts[run_count - 1], nodes + run_starts[run_count - 1], (list->size - run_starts[run_count - 1]) * sizeof(node *));
+		}
+		for (i = 1; i <= pairs; i++) {
+			run_starts[i] = run_starts[2 * i];
+		}
+		run_starts[pairs + run_count % 2] = list->size;
+		run_count = pairs + run_count % 2;
+		temp_nodes = nodes;
+		nodes = next_nodes;
+		next_nodes = temp_nodes;
+	}
+	stop_sort_workers_ll(&workers);
+
+	for (i = 1; i < list->size; i++) {
+		nodes[i - 1]->next = nodes[i];
+	}
+
+	list->head = nodes[0];
+	list->tail = nodes[list->size - 1];
+	list->tail->next = NULL;
+	refresh_indexes_ll(list);
+	free(nodes);
+	free(next_nodes);
+	free(jobs);
+	free(run_starts);
+}
+
+// Sorted part of the list found by natural_merge_sort_ll, head to tail with tail->next set to NULL
+typedef struct sorted_run {
+	node *head;
+	node *tail;
+} sorted_run;
+
+// Merges two runs into a, taking from a unless the value of b is bigger like merge_sort_ll does
+static void merge_sorted_runs_ll(int (*compare)(const void *, const void *), sorted_run *a, sorted_run *b) {
+	node *left = a->head;
+	node *right = b->head;
+	node *last;
+
+	if (compare(left->value, right->value) >= 0) {
+		a->head = last = left;
+		left = left->next;
+	} else {
+		a->head = last = right;
+		right = right->next;
+	}
+	while (left != NULL && right != NULL) {
+		if (compare(left->value, right->value) >= 0) {
+			last = last->next = left;
+			left = left->next;
+		} else {
+			last = last->next = right;
+			right = right->next;
+		}
+	}
+
+	last->next = (left != NULL) ? left : right;
+	if (left == NULL) {
+		a->tail = b->tail;
+	}
+}
+
+size_t natural_merge_sort_ll(linked_list *list) {
+	if (list->size <= 1) {
+		return list->size;
+	}
+
+	if (list->compare == NULL) {
+		printf("Called natural_merge_sort_ll without giving the linked list a compare function?!\nSet it by set_compare_ll\n");
+		return 0;
+	}
+	settle_links_ll(list);
+
+	size_t run_capacity = 16;
+	size_t run_count = 0;
+	sorted_run *runs = (sorted_run*) malloc (run_capacity * sizeof(sorted_run));
+	int reversed = 0;
+	node *curr = list->head;
+	node *prev;
+
+	while (curr != NULL) {
+		node *run_head = curr;
+		prev = curr;
+		curr = curr->next;
+		if (run_count == run_capacity) {
+			run_capacity <<= 1;
+			runs = (sorted_run*) realloc (runs, run_capacity * sizeof(sorted_run));
+		}
+
+		if (curr != NULL && list->compare(prev->value, curr->value) < 0) {
+			// Strictly ascending, so reversing it in place keeps the sort stable
+			while (curr != NULL && list->compare(prev->value, curr->value) < 0) {
+				prev = curr;
+				curr = curr->next;
+			}
+			node *reversed_head = NULL;
+			node *next;
+			for (node *moved = run_head; moved != curr; moved = next) {
+				next = moved->next;
+				moved->next = reversed_head;
+				reversed_head = moved;
+			}
+			runs[run_count].head = prev;
+			runs[run_count].tail = run_head;
+			reversed = 1;
+		} else {
+			while (curr != NULL && list->compare(prev->value, curr->value) >= 0) {
+				prev = curr;
+				curr = curr->next;
+			}
+			prev->next = NULL;
+			runs[run_count].head = run_head;
+			runs[run_count].tail = prev;
+		}
+		run_count++;
+	}
+
+	size_t found = run_count;
+	if (run_count > 1 || reversed) {
+		invalidate_positions_ll(list);
+	}
+	// Neighbouring runs are merged in pairs until one is left, O(n log(runs))
+	while (run_count > 1) {
+		size_t merged = 0;
+		for (size_t i = 0; i + 1 < run_count; i += 2) {
+			merge_sorted_runs_ll(list->compare, &runs[i], &runs[i + 1]);
+			runs[merged++] = runs[i];
+		}
+		if (run_count % 2) {
+			runs[merged++] = runs[run_count - 1];
+		}
+		run_count = merged;
+	}
+
+	list->head = runs[0].head;
+	list->tail = runs[0].tail;
+	refresh_indexes_ll(list);
+	free(runs);
+	return found;
+}
+
+void merge_sort_in_place_ll(linked_list *list) {
+	if (list->size <= 1) {
+		return;
+	}
+
+	if (list->compare == NULL) {
+		printf("Called merge_sort_in_place_ll without giving the linked list a compare function?!\nSet it by set_compare_ll\n");
+		return;
+	}
+	invalidate_positions_ll(list);
+
+	// Bottom up like merge_sort_ll, but depth first: pending[i] holds a sorted run of 2^i nodes or nothing and works
+	// like a binary counter, so runs are merged while their nodes are still in the cache. Older runs sit higher and go
+	// first in every merge, which keeps the sort stable. 64 runs are enough for any list that fits in memory
+	sorted_run pending[sizeof(size_t) * 8];
+	sorted_run carry;
+	size_t used = 0;
+	size_t i;
+	node *next;
+
+	for (node *curr = list->head; curr != NULL; curr = next) {
+		next = curr->next;
+		curr->next = NULL;
+		carry.head = carry.tail = curr;
+		for (i = 0; i < used && pending[i].head != NULL; i++) {
+			merge_sorted_runs_ll(list->compare, &pending[i], &carry);
+			carry = pending[i];
+			pending[i].head = NULL;
+		}
+		pending[i] = carry;
+		if (i == used) {
+			used++;
+		}
+	}
+
+	carry.head = NULL;
+	for (i = 0; i < used; i++) {
+		if (pending[i].head == NULL) {
+			continue;
+		} if (carry.head != NULL) {
+			merge_sorted_runs_ll(list->compare, &pending[i], &carry);
+		}
+		carry = pending[i];
+	}
+
+	list->head = carry.head;
+	list->tail = carry.tail;
+	refresh_indexes_ll(list);
+}
+
+// State of a merge sort spread over calls to sort_step_ll. It works like merge_sort_in_place_ll, but the runs stay
+// linked in the list (oldest first, then carry, then the nodes not read yet) and merges can stop after any comparison
+typedef struct ll_sort {
+	linked_list *list;
+	sorted_run pending[sizeof(size_t) * 8];
+	size_t used; // Slots of pending used so far
+	sorted_run carry; // Run being carried up into slot, head is NULL if there is none
+	size_t slot;
+	node *rest; // First node not read yet
+	int finishing; // Every node was read, the pending runs are merged from the newest up
+	int merging; // A merge of pending[slot] and carry is in progress
+	node *start; // Node before the merged nodes, NULL at the head
+	node *placed; // Last node put in place by the merge, NULL if none yet
+	node *left; // First node of pending[slot] not placed yet
+	node *right; // First node of carry not placed yet
+	int done;
+} ll_sort;
+
+// Starts merging pending[slot] and the carry right after it
+static void start_sort_merge_ll(ll_sort *sort) {
+	sort->start = NULL;
+	for (size_t older = sort->slot + 1; older < sort->used; older++) {
+		if (sort->pending[older].head != NULL) {
+			sort->start = sort->pending[older].tail;
+			break;
+		}
+	}
+	sort->placed = sort->start;
+	sort->left = sort->pending[sort->slot].head;
+	sort->right = sort->carry.head;
+	sort->merging = 1;
+}
+
+// Places one node of the merge, the left one on ties like merge_sort_ll. The node after the last left node is always the
+// first right one not placed, so every node stays linked. Returns 1 once the merge is done
+static int sort_merge_step_ll(ll_sort *sort) {
+	linked_list *list = sort->list;
+	node *left_last = sort->pending[sort->slot].tail;
+	node *right_last = sort->carry.tail;
+	node *taken;
+	int finished;
+
+	if (list->compare(sort->left->value, sort->right->value) >= 0) {
+		taken = sort->left;
+		finished = taken == left_last;
+		sort->left = taken->next;
+	} else {
+		taken = sort->right;
+		finished = taken == right_last;
+		sort->right = taken->next;
+		left_last->next = taken->next;
+		if (taken->next == NULL) {
+			list->tail = left_last;
+		}
+		if (sort->placed == NULL) {
+			list->head = taken;
+		} else {
+			sort->placed->next = taken;
+		}
+		taken->next = sort->left;
+	}
+	sort->placed = taken;
+	if (!finished) {
+		return 0;
+	}
+
+	sort->carry.head = (sort->start == NULL) ? list->head : sort->start->next;
+	sort->carry.tail = (taken == left_last) ? right_last : left_last;
+	sort->pending[sort->slot].head = NULL;
+	sort->slot++;
+	sort->merging = 0;
+	return 1;
+}
+
+ll_sort *sort_begin_ll(linked_list *list) {
+	if (list->compare == NULL) {
+		printf("Called sort_begin_ll without giving the linked list a compare function?!\nSet it by set_compare_ll\n");
+		return NULL;
+	}
+	invalidate_positions_ll(list);
+
+	ll_sort *sort = (ll_sort*) list->allocate (sizeof(ll_sort));
+	sort->list = list;
+	sort->used = 0;
+	sort->carry.head = NULL;
+	sort->slot = 0;
+	sort->rest = list->head;
+	sort->finishing = 0;
+	sort->merging = 0;
+	sort->done = 0;
+	list->memory.allocations++;
+	return sort;
+}
+
+int sort_step_ll(ll_sort *sort, size_t budget) {
+	size_t comparisons = 0;
+	invalidate_positions_ll(sort->list); // In case the list was read between steps
+
+	while (!sort->done && comparisons < budget) {
+		if (sort->merging) {
+			sort_merge_step_ll(sort);
+			comparisons++;
+		} else if (sort->carry.head != NULL) {
+			while (sort->slot < sort->used && sort->pending[sort->slot].head == NULL && sort->finishing) {
+				sort->slot++; // Every run is merged into the next older one once the nodes are read
+			}
+			if (sort->slot < sort->used && sort->pending[sort->slot].head != NULL) {
+				start_sort_merge_ll(sort);
+			} else if (sort->finishing) {
+				sort->done = 1;
+			} else {
+				sort->pending[sort->slot] = sort->carry;
+				if (sort->slot == sort->used) {
+					sort->used++;
+				}
+				sort->carry.head = NULL;
+			}
+		} else if (sort->rest != NULL) {
+			sort->carry.head = sort->carry.tail = sort->rest;
+			sort->rest = sort->rest->next;
+			sort->slot = 0;
+		} else {
+			sort->finishing = 1;
+			for (sort->slot = 0; sort->slot < sort->used && sort->pending[sort->slot].head == NULL; sort->slot++);
+			if (sort->slot == sort->used) {
+				sort->done = 1; // Empty list
+			} else {
+				sort->carry = sort->pending[sort->slot];
+				sort->pending[sort->slot].head = NULL;
+				sort->slot++;
+			}
+		}
+	} if (sort->done) {
+		refresh_indexes_ll(sort->list);
+	}
+	return sort->done;
+}
+
+void sort_finish_ll(ll_sort *sort) {
+	linked_list *list = sort->list;
+	sort_step_ll(sort, (size_t) -1);
+	list->deallocate(sort);
+	list->memory.deallocations++;
+}
+
+void radix_sort_ll(linked_list *list, unsigned long long (*key_p)(const void *value)) {
+	if (list->size <= 1) {
+		return;
+	}
+
+	if (key_p == NULL) {
+		printf("Called radix_sort_ll without a key function?!\n");
+		return;
+	}
+	invalidate_positions_ll(list);
+
+	unsigned long long *keys = (unsigned long long *) malloc (list->size * sizeof(unsigned long long));
+	unsigned long long *next_keys = (unsigned long long *) malloc (list->size * sizeof(unsigned long long));
+	unsigned long long *temp_keys;
+	node **nodes = (node **) malloc (list->size * sizeof(node *));
+	node **next_nodes = (node **) malloc (list->size * sizeof(node *));
+	node **temp_nodes;
+	size_t counts[sizeof(unsigned long long)][256] = {{0}};
+	size_t i = 0;
+
+	for (node *curr = list->head; curr != NULL; curr = curr->next) {
+		nodes[i] = curr;
+		keys[i] = ~key_p(curr->value); // Complemented so the ascending passes put the biggest key first like merge_sort_ll
+		for (size_t digit = 0; digit < sizeof(unsigned long long); digit++) {
+			counts[digit][(keys[i] >> (digit * 8)) & 255]++;
+		}
+		i++;
+	}
+
+	for (size_t digit = 0; digit < sizeof(unsigned long long); digit++) {
+		size_t *count = counts[digit];
+		if (count[(keys[0] >> (digit * 8)) & 255] == list->size) {
+			continue; // Every key has the same byte here, so 32 bit keys only take 4 passes
+		}
+
+		size_t offset = 0;
+		size_t bucket_size;
+		for (i = 0; i < 256; i++) {
+			bucket_size = count[i];
+			count[i] = offset;
+			offset += bucket_size;
+		}
+		for (i = 0; i < list->size; i++) {
+			size_t position = count[(keys[i] >> (digit * 8)) & 255]++;
+			next_keys[position] = keys[i];
+			next_nodes[position] = nodes[i];
+		}
+		temp_keys = keys;
+		keys = next_keys;
+		next_keys = temp_keys;
+		temp_nodes = nodes;
+		nodes = next_nodes;
+		next_nodes = temp_nodes;
+	}
+
+	for (i = 1; i < list->size; i++) {
+		nodes[i - 1]->next = nodes[i];
+	}
+
+	list->head = nodes[0];
+	list->tail = nodes[list->size - 1];
+	list->tail->next = NULL;
+	refresh_indexes_ll(list);
+	free(keys);
+	free(next_keys);
+	free(nodes);
+	free(next_nodes);
+}
+
+unsigned long long int_key_ll(const void *value) {
+	return (unsigned int) *(const int*) value ^ 0x80000000u;
+}
+
+unsigned long long long_key_ll(const void *value) {
+	return (unsigned long long) *(const long*) value ^ (1ULL << (sizeof(long) * 8 - 1));
+}
+
+unsigned long long float_key_ll(const void *value) {
+	unsigned int bits;
+	memcpy(&bits, value, sizeof(bits));
+	return (bits & 0x80000000u) ? ~bits : bits | 0x80000000u; // Negative floats are ordered backwards by their bits
+}
+
+unsigned long long double_key_ll(const void *value) {
+	unsigned long long bits;
+	memcpy(&bits, value, sizeof(bits));
+	return (bits >> 63) ? ~bits : bits | (1ULL << 63);
+}
+
+int is_sorted_ll(linked_list *list) {
+	if (list->size <= 1) {
+		return 1;
+	}
+
+	if (list->compare == NULL) {
+		printf("Called is_sorted_ll without giving the linked list a compare function?!\nSet it by set_compare_ll\n");
+		return 0;
+	}
+	for (node *curr = list->head; curr != list->tail; curr = NEXT_NODE(list, curr)) {
+		if (list->compare(curr->value, NEXT_NODE(list, curr)->value) == -1) {
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+
+size_t get_index_ll(linked_list *list, void *value, size_t occurrence) { // returns 0 <= x < size if successfull else returns size
+	if (list == NULL || value == NULL || !occurrence) {
+		return list->size;
+	}
+
+	// Looking up never writes to the list, the edits made in the middle since the groups were built are replayed instead
+	size_t curr_index = 0;
+	node *curr = list->head;
+	if (list->hash != NULL && list->hash->valid) {
+		value_group *group = find_group_ll(list, value, list->hash->hash(value));
+		if (group->count < occurrence) {
+			return list->size;
+		}
+		return current_key_ll(list->hash, &group->occurrences[occurrence - 1]) - list->hash->head_key;
+	}
+
+	while (curr) {
+		if (!list->compare(curr->value, value)) {
+			occurrence--;
+			if (!occurrence) {
+				return curr_index;
+			}
+		}
+		curr = NEXT_NODE(list, curr);
+		curr_index++;
+	}
+
+	return list->size;
+}
+
+int contains_ll(linked_list *list, void *value) {
+	if (list->hash != NULL && list->hash->valid) {
+		return find_group_ll(list, value, list->hash->hash(value))->count > 0;
+	}
+	return get_index_ll(list, value, 1) != list->size;
+}
+
+void **get_as_array_ll(linked_list *list) { // Still need to free the linked list and the array, be careful if the data contains pointers to elsewhere the data is deep copied.
+	if (list == NULL) {
+		return NULL;
+	}
+	void **array = malloc (list->size * sizeof(void *));
+	node *curr = list->head;
+	size_t i = 0;
+
+	while (curr != NULL) {
+		array[i] = malloc (VAL_SIZE(list, curr));
+		copy_value_ll(list, array[i], curr->value, VAL_SIZE(list, curr), list->deep_copyv);
+		i++; curr = NEXT_NODE(list, curr);
+	}
+
+	return array;
+}
+
+void *get_packed_array_ll(linked_list *list, size_t *packed_size) { // One buffer holding every value back to back, only the buffer has to be freed
+	if (list == NULL) {
+		return NULL;
+	}
+	size_t bytes = list->size * list->elem_size;
+	if (!list->elem_size) {
+		for (node *curr = list->head; curr != NULL; curr = NEXT_NODE(list, curr)) {
+			bytes += VAL_SIZE(list, curr);
+		}
+	}
+	char *packed = malloc (bytes ? bytes : 1);
+	char *dest = packed;
+
+	for (node *curr = list->head; curr != NULL; curr = NEXT_NODE(list, curr)) {
+		copy_value_ll(list, dest, curr->value, VAL_SIZE(list, curr), list->deep_copyv);
+		dest += VAL_SIZE(list, curr);
+	}
+
+	if (packed_size != NULL) {
+		*packed_size = bytes;
+	}
+	return packed;
+}
+
+void **view_as_array_ll(linked_list *list) { // Points at the values stored in the list, nothing is copied
+	if (list == NULL) {
+		return NULL;
+	}
+	void **array = malloc (list->size * sizeof(void *));
+	size_t i = 0;
+
+	for (node *curr = list->head; curr != NULL; curr = NEXT_NODE(list, curr)) {
+		array[i++] = curr->value;
+	}
+
+	return array;
+}
+
+void **convert_to_array_ll(linked_list *list) { // This one creates the array while freeing the linked list
+	if (list == NULL) {
+		return NULL;
+	}
+	settle_links_ll(list);
+
+	void **array = malloc (list->size * sizeof(void *));
+	node *curr = list->head;
+	node *prev = NULL;
+	list->head = NULL;
+	size_t i = 0;
+
+	while (curr != NULL) { // Values with their own allocation are handed over as they are, inline ones are copied out
+		prev = curr;
+		curr = curr->next;
+		array[i++] = take_value_ll(list, prev);
+	}
+
+	free_list_struct_ll(list);
+	return array;
+}
+
+// Links copies of the values in array into the empty list, each value is given to the free function after it is copied
+// if free_values is 1
+static void array_into_ll(linked_list *list, void **array, size_t size_of_array, size_t size_of_value, void (*freev)(void *), int free_values) {
+	list->freev = (freev == NULL) ? free : freev;
+
+	if (array == NULL || size_of_array == 0) {
+		return;
+	}
+
+	list->head = new_node_ll(list, size_of_value);
+	copy_value_ll(list, list->head->value, array[0], size_of_value, memcpy);
+	list->tail = list->head;
+
+	for (size_t i = 1; i < size_of_array; i++) {
+		list->tail->next = new_node_ll(list, size_of_value);
+		copy_value_ll(list, list->tail->next->value, array[i], size_of_value, memcpy);
+		list->tail = list->tail->next;
+	}
+	list->tail->next = NULL;
+	list->size = size_of_array;
+
+	if (free_values) {
+		for (size_t i = 0; i < size_of_array; i++) {
+			list->freev(array[i]);
+		}
+	}
+}
+
+linked_list *array_to_linked_list(void **array, size_t size_of_array, size_t size_of_value, void *(*allocator_p)(size_t), void (*freev)(void *)) { // Assumes array is already stored on heap
+	linked_list *list = new_linked_list(allocator_p);
+	array_into_ll(list, array, size_of_array, size_of_value, freev, 1);
+	free(array);
+	return list;
+}
+
+linked_list *array_to_fixed_linked_list(void **array, size_t size_of_array, size_t size_of_value, void *(*allocator_p)(size_t), void (*freev)(void *)) {
+	linked_list *list = new_fixed_linked_list(size_of_value, allocator_p);
+	array_into_ll(list, array, size_of_array, size_of_value, freev, 1);
+	free(array);
+	return list;
+}
+
+linked_list *array_adopt_linked_list(void **array, size_t size_of_array, size_t size_of_value, void *(*allocator_p)(size_t), void (*freev)(void *)) { // Assumes array and values are stored on heap
+	linked_list *list = new_linked_list(allocator_p);
+	list->freev = (freev == NULL) ? free : freev;
+
+	if (array == NULL) {
+		return list;
+	}
+
+	for (size_t i = 0; i < size_of_array; i++) {
+		link_tail_ll(list, adopt_node_ll(list, array[i], size_of_value));
+	}
+
+	free(array);
+	return list;
+}
+
+linked_list *buffer_to_linked_list(const void *buffer, size_t count, size_t elem_size, void *(*allocator_p)(size_t)) {
+	linked_list *list = new_fixed_linked_list(elem_size, allocator_p);
+	set_arena_ll(list, DEFAULT_CHUNK_SIZE);
+	append_many_ll(list, buffer, count, list->elem_size);
+	return list;
+}
+
+linked_list *array_as_linked_list(void **array, size_t size_of_array, size_t size_of_value, void *(*allocator_p)(size_t), void (*freev)(void*)) {// Assumes array is already stored on heap does not free array
+	linked_list *list = new_linked_list(allocator_p);
+	array_into_ll(list, array, size_of_array, size_of_value, freev, 0);
+	return list;
+}
+
+linked_list *array_as_fixed_linked_list(void **array, size_t size_of_array, size_t size_of_value, void *(*allocator_p)(size_t), void (*freev)(void*)) {
+	linked_list *list = new_fixed_linked_list(size_of_value, allocator_p);
+	array_into_ll(list, array, size_of_array, size_of_value, freev, 0);
+	return list;
+}
+
+int internal_check_ll(linked_list *list, int fix) {// returns amount of tests failed 0 - 2
+	settle_links_ll(list);
+	printf("##### ##### ##### START OF INTERNAL CHECK ##### ##### #####\n");
+	printf("_____ Function Addresses _____\n");
+	printf("printv address:     %p\n", list->printv);
+	printf("freev address:      %p\n", list->freev);
+	printf("deep_copyv address: %p\n", list->deep_copyv);
+	printf("allocate address:   %p\n", list->allocate);
+	printf("compare address:    %p\n", list->compare);
+	printf("list head address:  %p\n\n", list->head);
+
+	char tests_passed = 0;
+	size_t size = 0;
+	node *curr = list->head;
+
+	if (curr != NULL) {
+		while (curr->next != NULL) {
+			size++;
+			curr = curr->next;
+		}
+		size++;
+	}
+	
+	printf("_____ Tail and Size Tests _____\n");
+	printf("Stored list size:  %zu\n", list->size);
+	printf("Checked list size: %zu\n", size);
+	if (list->size == size) {
+		tests_passed++;
+		printf("-> Size test passed!\n");
+	} else {
+		printf("-> Size test failed!\n");
+	}
+	
+	printf("Stored tail address:  %p\n", list->tail);
+	printf("Checked tail address: %p\n", curr);
+	if (curr == list->tail) {
+		tests_passed++;
+		printf("-> Tail test passed!\n");
+	} else {
+		printf("-> Tail test failed!\n");
+	}
+	
+	printf("\n_____ Overview _____\n");
+	printf("%d/2 Tests passed\n\n", tests_passed);
+
+	if (fix) {
+		list->size = size;
+		list->tail = curr;
+		printf("Size and tail set to what was found during check.\n");
+	} else if (tests_passed != 2) {
+		printf("Failed tests not fixed.\nIf you want to fix them use fix_ll or this function with the fix parameter set to a non zero value.\n");
+	}
+	printf("##### ##### ##### -END- OF INTERNAL CHECK ##### ##### #####\n");
+
+	return 2 - tests_passed;
+}
+
+void fix_ll(linked_list *list, int display_fix_message) {
+	node *curr = list->head;
+	size_t size = 0;
+	invalidate_positions_ll(list);
+
+	if (curr != NULL) {
+		while (curr->next != NULL) {
+			size++;
+			curr = curr->next;
+		}
+		size++;
+	}
+
+	if (display_fix_message) {
+		if (size != list->size) {
+			printf("Previous size: %zu\n", list->size);
+			printf("Fixed size:    %zu\n", size);
+		} if (curr != list->tail) {
+			printf("Previous tail: %p\n", list->tail);
+			printf("Fixed tail:    %p\n", curr);
+		}
+	}
+
+	list->size = size;
+	list->tail = curr;
+	refresh_indexes_ll(list);
+}
+
+// Size a node gets in the slab made by defragment_ll for a pooled list, 1 byte is kept after nodes whose value
+// stays outside so a value allocated on its own can never sit where an inline value would
+static size_t defragmented_size_ll(linked_list *list, node *curr) {
+	if (!IS_ARENA(list->pool)) {
+		return list->pool->slot_size;
+	}
+	return PAYLOAD_OFFSET(list) + (VALUE_IS_INLINE(list, curr) ? VAL_SIZE(list, curr) : 1);
+}
+
+// Copies every node of a list without a pool into a new block of its own, in list order. Where the blocks end up is
+// up to the allocater, nodes freed one at a time can not share a block so no single block is made for them
+static void defragment_heap_ll(linked_list *list, int include_values) {
+	node *curr;
+	node *next;
+	node *copy;
+
+	// While copying, the next pointer of every old node is set to its copy, the copies still point to the old nodes
+	for (curr = list->head; curr != NULL; curr = next) {
+		next = curr->next;
+		int is_inline = list->co_allocate && VALUE_IS_INLINE(list, curr);
+		if (list->co_allocate) {
+			copy = (node*) list->allocate (PAYLOAD_OFFSET(list) + (is_inline ? VAL_SIZE(list, curr) : 1));
+		} else {
+			copy = (node*) list->allocate (HEADER_SIZE(list));
+		}
+		memcpy(copy, curr, HEADER_SIZE(list));
+		list->memory.allocations++;
+		if (is_inline) {
+			copy->value = (char*) copy + PAYLOAD_OFFSET(list);
+			memcpy(copy->value, curr->value, VAL_SIZE(list, curr));
+		} else if (!list->co_allocate && include_values) {
+			copy->value = list->allocate (VAL_SIZE(list, curr));
+			memcpy(copy->value, curr->value, VAL_SIZE(list, curr));
+			list->memory.allocations++;
+		}
+		STAMP_NODE(copy);
+		curr->next = copy;
+	}
+
+	node *old_node = list->head;
+	node *old_next;
+	list->head = old_node->next;
+	for (copy = list->head; old_node != NULL; copy = copy->next) {
+		old_next = copy->next;
+		if (!list->co_allocate && old_node->value != copy->value) {
+			list->deallocate(old_node->value);
+			list->memory.deallocations++;
+		}
+		RETIRE_NODE(old_node);
+		list->deallocate(old_node);
+		list->memory.deallocations++;
+		copy->next = (old_next == NULL) ? NULL : old_next->next;
+		list->tail = copy;
+		old_node = old_next;
+	}
+}
+
+size_t defragment_ll(linked_list *list, int include_values) {
+	if (list->head == NULL) {
+		return 0;
+	} if (list->pool != NULL && list->pool->refs > 1) {
+		printf("Attempted to defragment a linked list that shares its pool with another linked list!\n");
+		return 0;
+	}
+	invalidate_positions_ll(list);
+
+	if (list->pool == NULL) {
+		defragment_heap_ll(list, include_values);
+		refresh_indexes_ll(list);
+		return 0;
+	}
+
+	node_pool *old_pool = list->pool;
+	size_t total = 0;
+	node *curr;
+
+	for (curr = list->head; curr != NULL; curr = curr->next) {
+		total += ALIGN_UP(defragmented_size_ll(list, curr));
+	}
+
+	// The first slab fits the whole list so the nodes end up next to each other in list order
+	node_pool *new_pool = new_pool_ll(list, old_pool->slot_size, total);
+	node *prev = NULL;
+	node *new_node;
+
+	for (curr = list->head; curr != NULL; curr = curr->next) {
+		new_node = (node*) carve_ll(new_pool, defragmented_size_ll(list, curr));
+		memcpy(new_node, curr, HEADER_SIZE(list));
+		if (VALUE_IS_INLINE(list, curr)) {
+			new_node->value = (char*) new_node + PAYLOAD_OFFSET(list);
+			memcpy(new_node->value, curr->value, VAL_SIZE(list, curr));
+		} else {
+			new_pool->outside_values++;
+		}
+		RETIRE_NODE(curr);
+		STAMP_NODE(new_node);
+
+		if (prev == NULL) {
+			list->head = new_node;
+		} else {
+			prev->next = new_node;
+		}
+		prev = new_node;
+	}
+
+	prev->next = NULL;
+	list->tail = prev;
+	new_pool->slab_size = old_pool->slab_size;
+	size_t reclaimed = (old_pool->reserved > new_pool->reserved) ? old_pool->reserved - new_pool->reserved : 0;
+	release_pool_ll(old_pool);
+	list->pool = new_pool;
+	recount_memory_ll(list);
+	for (curr = list->head; curr != NULL; curr = curr->next) {
+		new_pool->live += node_footprint_ll(list, curr);
+	}
+	refresh_indexes_ll(list);
+
+	return reclaimed;
+}
+
+void combine_ll(linked_list *combined, linked_list *freed) {
+	invalidate_positions_ll(combined);
+	settle_links_ll(freed);
+	if (freed->head == NULL) {
+		// Nothing to link
+	} else if (same_storage_ll(combined, freed)) {
+		if (combined->head == NULL) {
+			combined->head = freed->head;
+		} else {
+			combined->tail->next = freed->head;
+		}
+		combined->tail = freed->tail;
+	} else {
+		node *next;
+		node *moved;
+		for (node *curr = freed->head; curr != NULL; curr = next) {
+			next = curr->next;
+			moved = move_node_ll(combined, freed, curr);
+			if (combined->head == NULL) {
+				combined->head = moved;
+			} else {
+				combined->tail->next = moved;
+			}
+			combined->tail = moved;
+		}
+		combined->tail->next = NULL;
+	}
+	combined->size += freed->size;
+	combined->memory.node_bytes += freed->memory.node_bytes; // Nodes moved one by one were already taken off freed
+	combined->memory.value_bytes += freed->memory.value_bytes;
+	combined->memory.overhead_bytes += freed->memory.overhead_bytes;
+	combined->memory.allocations += freed->memory.allocations;
+	combined->memory.deallocations += freed->memory.deallocations;
+	retain_strings_ll(combined, freed);
+	free_list_struct_ll(freed);
+	refresh_indexes_ll(combined);
+}
+
+size_t splice_ll(linked_list *dst, size_t dst_index, linked_list *src, size_t start, size_t end) {
+	if (dst == src) {
+		printf("Cannot splice a linked list into itself...\n");
+		return 0;
+	} else if (end < start) {
+		printf("Start index cannot be greater than end index...\n");
+		return 0;
+	} else if (end >= src->size || dst_index > dst->size) {
+		return 0; // No message here
+	}
+
+	// Found before the positions are dropped so the skip index and finger can still help
+	node *before_start = (start == 0) ? NULL : node_at_ll(src, start - 1);
+	node *before_dst = (dst_index == 0) ? NULL : node_at_ll(dst, dst_index - 1);
+	invalidate_positions_ll(src);
+	invalidate_positions_ll(dst);
+
+	node *curr = (before_start == NULL) ? src->head : before_start->next;
+	node *after_end = NULL;
+	node *first = NULL;
+	node *last = NULL;
+	node *moved;
+	size_t count = end - start + 1;
+
+	for (size_t i = 0; i < count; i++) {
+		after_end = curr->next;
+		if (same_storage_ll(dst, src)) {
+			count_node_ll(src, curr, -1);
+			count_node_ll(dst, curr, 1);
+			moved = curr;
+		} else {
+			moved = move_node_ll(dst, src, curr);
+		}
+
+		if (last == NULL) {
+			first = moved;
+		} else {
+			last->next = moved;
+		}
+		last = moved;
+		curr = after_end;
+	}
+
+	if (before_start == NULL) {
+		src->head = after_end;
+	} else {
+		before_start->next = after_end;
+	} if (after_end == NULL) {
+		src->tail = before_start;
+	}
+	src->size -= count;
+
+	if (before_dst == NULL) {
+		last->next = dst->head;
+		dst->head = first;
+	} else {
+		last->next = before_dst->next;
+		before_dst->next = first;
+	} if (last->next == NULL) {
+		dst->tail = last;
+	}
+	dst->size += count;
+
+	// The groups of the hash index can not be moved along with the nodes
+	if (src->hash != NULL) {
+		refresh_hash_ll(src);
+	} if (dst->hash != NULL) {
+		refresh_hash_ll(dst);
+	}
+	retain_strings_ll(dst, src);
+	return count;
+}
+
+linked_list *split_at_ll(linked_list *list, size_t index) {
+	if (index > list->size) {
+		return NULL; // No message here
+	}
+
+	linked_list *new_list = new_linked_list(list->allocate);
+	new_list->printv = list->printv;
+	new_list->freev = list->freev;
+	new_list->deep_copyv = list->deep_copyv;
+	new_list->compare = list->compare;
+	share_storage_ll(new_list, list, 0); // The nodes stay in the storage they were allocated from
+
+	if (index < list->size) {
+		splice_ll(new_list, 0, list, index, list->size - 1);
+	}
+	return new_list;
+}
+
+ll_memory_stats get_memory_stats_ll(linked_list *list) {
+	ll_memory_stats stats = list->memory;
+	stats.overhead_bytes += list->index_bytes;
+	if (list->pool != NULL) {
+		// Slabs are shared by every list using the pool, so their calls and unused bytes are reported by all of them
+		stats.allocations += list->pool->allocations;
+		stats.deallocations += list->pool->deallocations;
+		stats.overhead_bytes += list->pool->reserved - list->pool->live;
+	} if (list->strings != NULL) {
+		// Strings live in the store, the nodes only hold pointers to them
+		stats.value_bytes += list->strings->bytes->live;
+		stats.overhead_bytes += list->strings->bytes->reserved - list->strings->bytes->live;
+		if (list->strings->entries != NULL) {
+			stats.overhead_bytes += list->strings->capacity * sizeof(string_entry);
+		}
+		stats.allocations += list->strings->bytes->allocations;
+		stats.deallocations += list->strings->bytes->deallocations;
+	}
+	return stats;
+}
+
+int get_int_val_ll(linked_list *list, size_t index) {
+	return *(int*) get_data_ll(list, index);
+}
+
+unsigned int get_uint_val_ll(linked_list *list, size_t index) {
+	return *(unsigned int*) get_data_ll(list, index);
+}
+
+long get_long_val_ll(linked_list *list, size_t index) {
+	return *(long*) get_data_ll(list, index);
+}
+
+unsigned long get_ulong_val_ll(linked_list *list, size_t index) {
+	return *(unsigned long*) get_data_ll(list, index);
+}
+
+short get_short_val_ll(linked_list *list, size_t index) {
+	return *(short*) get_data_ll(list, index);
+}
+
+unsigned short get_ushort_val_ll(linked_list *list, size_t index) {
+	return *(unsigned short*) get_data_ll(list, index);
+}
+
+float get_float_val_ll(linked_list *list, size_t index) {
+	return *(float*) get_data_ll(list, index);
+}
+
+double get_double_val_ll(linked_list *list, size_t index) {
+	return *(double*) get_data_ll(list, index);
+}
+
+char get_char_val_ll(linked_list *list, size_t index) {
+	return *(char*) get_data_ll(list, index);
+}
+
+unsigned char get_uchar_val_ll(linked_list *list, size_t index) {
+	return *(unsigned char*) get_data_ll(list, index);
+}
+
+char *get_str_val_ll(linked_list *list, size_t index) {
+	return *(char**) get_data_ll(list, index);
+}
+
+static void print_str_ll(void *value) {
+	printf("String: %s\n", *(char**) value);
+}
+
+// Orders by bytes then by length, interned strings that are equal are the same pointer
+static int compare_str_ll(const void *a, const void *b) {
+	const char *aa = *(char* const*) a;
+	const char *bb = *(char* const*) b;
+	if (aa == bb) {
+		return 0;
+	}
+
+	size_t a_length = STR_LEN(aa);
+	size_t b_length = STR_LEN(bb);
+	int result = memcmp(aa, bb, (a_length < b_length) ? a_length : b_length);
+	if (result == 0) {
+		result = (a_length > b_length) - (a_length < b_length);
+	}
+	return (result > 0) - (result < 0);
+}
+
+linked_list *new_string_linked_list(int intern, void *(*allocator_p)(size_t)) {
+	linked_list *new_list = new_fixed_linked_list(sizeof(char *), allocator_p);
+	new_list->co_allocate = 1;
+	new_list->printv = print_str_ll;
+	new_list->compare = compare_str_ll;
+
+	string_store *store = (string_store*) new_list->allocate (sizeof(string_store));
+	store->refs = 1;
+	store->bytes = new_pool_ll(new_list, 0, DEFAULT_CHUNK_SIZE);
+	store->entries = NULL;
+	store->entries_used = 0;
+	store->capacity = 64;
+	store->retained = NULL;
+	if (intern) {
+		store->entries = (string_entry*) new_list->allocate (store->capacity * sizeof(string_entry));
+		memset(store->entries, 0, store->capacity * sizeof(string_entry));
+	}
+	new_list->strings = store;
+	return new_list;
+}
+
+// Prints a message and returns 0 if the list was not made with new_string_linked_list
+static int check_string_list_ll(linked_list *list, const char *function_name) {
+	if (list->strings == NULL) {
+		printf("Called %s on a linked list that was not made with new_string_linked_list!\n", function_name);
+		return 0;
+	}
+	return 1;
+}
+
+size_t append_str_ll(linked_list *list, const char *str) {
+	if (!check_string_list_ll(list, "append_str_ll")) {
+		return list->size;
+	}
+
+	char *stored = store_str_ll(list->strings, str);
+	return append_ll(list, &stored, sizeof(char *));
+}
+
+void prepend_str_ll(linked_list *list, const char *str) {
+	if (!check_string_list_ll(list, "prepend_str_ll")) {
+		return;
+	}
+
+	char *stored = store_str_ll(list->strings, str);
+	prepend_ll(list, &stored, sizeof(char *));
+}
+
+int insert_str_ll(linked_list *list, const char *str, size_t index) {
+	if (!check_string_list_ll(list, "insert_str_ll") || index >= list->size) {
+		return 0;
+	}
+
+	char *stored = store_str_ll(list->strings, str);
+	return insert_ll(list, &stored, sizeof(char *), index);
+}
+
+size_t get_str_len_ll(linked_list *list, size_t index) {
+	return STR_LEN(get_str_val_ll(list, index));
+}
+
+size_t get_index_str_ll(linked_list *list, const char *str, size_t occurrence) {
+	if (!check_string_list_ll(list, "get_index_str_ll") || str == NULL || !occurrence) {
+		return list->size;
+	}
+
+	size_t length = strlen(str);
+	const char *interned = NULL;
+	if (list->strings->entries != NULL && list->strings->retained == NULL) {
+		interned = find_entry_ll(list->strings, str, length, hash_str_ll(str, length))->str;
+		if (interned == NULL) {
+			return list->size; // Never stored so it cannot be in the list
+		}
+	}
+
+	size_t curr_index = 0;
+	const char *curr_str;
+	for (node *curr = list->head; curr != NULL; curr = NEXT_NODE(list, curr), curr_index++) {
+		curr_str = *(char**) curr->value;
+		if ((interned != NULL) ? curr_str == interned : (STR_LEN(curr_str) == length && !memcmp(curr_str, str, length))) {
+			if (!--occurrence) {
+				return curr_index;
+			}
+		}
+	}
+
+	return list->size;
+}
+
+
+
+typedef struct ul_block {
+	struct ul_block *next;
+	size_t count; // Elements stored in this block
+} ul_block;
+
+// Entry of the block index, the first element of block is at index key - head_key
+typedef struct ul_entry {
+	ul_block *block;
+	size_t key;
+} ul_entry;
+
+typedef struct unrolled_list {
+	size_t size;
+	size_t elem_size;
+	size_t block_capacity; // Max elements a block holds
+	void (*printv)(void*);
+	void (*freev)(void*); // Frees what an element points to, NULL if elements do not own anything
+	void *(*deep_copyv)(void * restrict destination, const void * restrict source, size_t size);
+	void *(*allocate)(size_t size);
+	void (*deallocate)(void *);
+	int (*compare)(const void * a, const void * b); // Same rules as the linked list compare
+	ul_entry *blocks; // Every block in list order, lookups binary search it instead of walking the blocks
+	size_t block_count;
+	size_t block_room; // Entries blocks has room for
+	size_t head_key; // Key of the head block, so prepending does not renumber the blocks, like the hash index does
+	ul_block *head;
+	ul_block *tail;
+} unrolled_list;
+
+#define BLOCK_DATA(block) ((char*) (block) + ALIGN_UP(sizeof(ul_block)))
+#define ELEMENT_UL(list, block, i) (BLOCK_DATA(block) + (i) * (list)->elem_size)
+
+unrolled_list *new_unrolled_list(size_t elem_size, size_t block_capacity, void *(*allocator_p)(size_t)) {
+	void *(*allocator)(size_t) = (allocator_p == NULL) ? malloc : allocator_p;
+	unrolled_list *new_list = (unrolled_list*) allocator (sizeof(unrolled_list));
+	new_list->size = 0;
+	new_list->elem_size = elem_size ? elem_size : 1;
+	if (block_capacity == 0) { // Around four cache lines of elements per block
+		block_capacity = 256 / new_list->elem_size;
+	}
+	new_list->block_capacity = (block_capacity < 2) ? 2 : block_capacity;
+	new_list->printv = NULL;
+	new_list->freev = NULL;
+	new_list->deep_copyv = memcpy;
+	new_list->allocate = allocator;
+	new_list->deallocate = free;
+	new_list->compare = NULL;
+	new_list->blocks = NULL;
+	new_list->block_count = 0;
+	new_list->block_room = 0;
+	new_list->head_key = 0;
+	new_list->head = NULL;
+	new_list->tail = NULL;
+	return new_list;
+}
+
+void set_free_ul(unrolled_list *list, void (*free_p)(void *)) {
+	list->freev = free_p;
+}
+
+void set_print_ul(unrolled_list *list, void (*print_p)(void *)) {
+	list->printv = print_p;
+}
+
+void set_deep_copy_ul(unrolled_list *list, void *(*deep_copy_p)(void * restrict destination, const void * restrict source, size_t size)) {
+	list->deep_copyv = deep_copy_p;
+}
+
+void set_deallocater_ul(unrolled_list *list, void (*deallocate_p)(void *)) {
+	list->deallocate = deallocate_p;
+}
+
+void set_compare_ul(unrolled_list *list, int (*compare_p)(const void *a, const void *b)) {
+	list->compare = compare_p;
+}
+
+size_t get_size_ul(unrolled_list *list) {
+	return list->size;
+}
+
+int is_empty_ul(unrolled_list *list) {
+	if (list->head == NULL) {
+		return 1;
+	} return 0;
+}
+
+void empty_ul(unrolled_list *list) {
+	ul_block *block = list->head;
+	ul_block *next;
+	while (block != NULL) {
+		next = block->next;
+		if (list->freev != NULL) {
+			for (size_t i = 0; i < block->count; i++) {
+				list->freev(ELEMENT_UL(list, block, i));
+			}
+		}
+		list->deallocate(block);
+		block = next;
+	}
+	list->head = list->tail = NULL;
+	list->size = 0;
+	list->block_count = 0;
+	list->head_key = 0;
+}
+
+void free_unrolled_list(unrolled_list *list) {
+	empty_ul(list);
+	if (list->blocks != NULL) {
+		list->deallocate(list->blocks);
+	}
+	list->deallocate(list);
+}
+
+static ul_block *new_block_ul(unrolled_list *list) {
+	ul_block *block = (ul_block*) list->allocate (ALIGN_UP(sizeof(ul_block)) + list->block_capacity * list->elem_size);
+	block->next = NULL;
+	block->count = 0;
+	return block;
+}
+
+#define FIRST_UL(list, pos) ((list)->blocks[pos].key - (list)->head_key)
+
+// Puts block at pos in the block index with its first element at index first
+static void index_block_ul(unrolled_list *list, size_t pos, ul_block *block, size_t first) {
+	if (list->block_count == list->block_room) {
+		list->block_room = list->block_room ? list->block_room * 2 : 16;
+		ul_entry *grown = (ul_entry*) list->allocate (list->block_room * sizeof(ul_entry));
+		if (list->blocks != NULL) {
+			memcpy(grown, list->blocks, list->block_count * sizeof(ul_entry));
+			list->deallocate(list->blocks);
+		}
+		list->blocks = grown;
+	}
+
+	memmove(list->blocks + pos + 1, list->blocks + pos, (list->block_count - pos) * sizeof(ul_entry));
+	list->blocks[pos].block = block;
+	list->blocks[pos].key = first + list->head_key;
+	list->block_count++;
+}
+
+static void unindex_block_ul(unrolled_list *list, size_t pos) {
+	list->block_count--;
+	memmove(list->blocks + pos, list->blocks + pos + 1, (list->block_count - pos) * sizeof(ul_entry));
+}
+
+// Moves the first element of every block after pos by delta (1 or -1), the head block is done by moving head_key
+static void shift_blocks_ul(unrolled_list *list, size_t pos, size_t delta) {
+	if (pos == 0) {
+		list->head_key -= delta;
+		list->blocks[0].key -= delta;
+		return;
+	}
+	for (size_t i = pos + 1; i < list->block_count; i++) {
+		list->blocks[i].key += delta;
+	}
+}
+
+// Builds the block index again from the blocks, for functions that relink them
+static void reindex_blocks_ul(unrolled_list *list) {
+	size_t first = 0;
+	list->block_count = 0;
+	list->head_key = 0;
+	for (ul_block *block = list->head; block != NULL; block = block->next) {
+		index_block_ul(list, list->block_count, block, first);
+		first += block->count;
+	}
+}
+
+// Returns the block holding the element at index (index < size) in O(log(blocks)), offset is set to where it is
+// inside the block and pos to where the block is in the block index
+static ul_block *find_block_ul(unrolled_list *list, size_t index, size_t *offset, size_t *pos) {
+	size_t low = 0;
+	size_t high = list->block_count - 1;
+	while (low < high) {
+		size_t mid = low + (high - low + 1) / 2;
+		if (FIRST_UL(list, mid) <= index) {
+			low = mid;
+		} else {
+			high = mid - 1;
+		}
+	}
+
+	*offset = index - FIRST_UL(list, low);
+	if (pos != NULL) {
+		*pos = low;
+	}
+	return list->blocks[low].block;
+}
+
+void prepend_ul(unrolled_list *list, void *data) {
+	if (list->head == NULL || list->head->count == list->block_capacity) {
+		ul_block *block = new_block_ul(list);
+		block->next = list->head;
+		list->head = block;
+		if (list->tail == NULL) {
+			list->tail = block;
+		}
+		index_block_ul(list, 0, block, 0);
+	}
+
+	memmove(ELEMENT_UL(list, list->head, 1), BLOCK_DATA(list->head), list->head->count * list->elem_size);
+	list->deep_copyv(BLOCK_DATA(list->head), data, list->elem_size);
+	list->head->count++;
+	list->size++;
+	shift_blocks_ul(list, 0, 1);
+}
+
+// Returns where the next element goes at the end of the list, the caller copies it there
+static void *append_slot_ul(unrolled_list *list) {
+	if (list->tail == NULL || list->tail->count == list->block_capacity) {
+		ul_block *block = new_block_ul(list);
+		if (list->tail == NULL) {
+			list->head = block;
+		} else {
+			list->tail->next = block;
+		}
+		list->tail = block;
+		index_block_ul(list, list->block_count, block, list->size);
+	}
+
+	list->size++;
+	return ELEMENT_UL(list, list->tail, list->tail->count++);
+}
+
+size_t append_ul(unrolled_list *list, void *data) {
+	list->deep_copyv(append_slot_ul(list), data, list->elem_size);
+	return list->size - 1;
+}
+
+int insert_ul(unrolled_list *list, void *data, size_t index) {
+	if (index > list->size) {
+		return 0;
+	} if (index == list->size) {
+		append_ul(list, data);
+		return 1;
+	} if (index == 0) {
+		prepend_ul(list, data);
+		return 1;
+	}
+
+	size_t offset;
+	size_t pos;
+	ul_block *block = find_block_ul(list, index, &offset, &pos);
+
+	if (block->count == list->block_capacity) { // Split, the upper half moves into a new block
+		size_t half = list->block_capacity / 2;
+		ul_block *upper = new_block_ul(list);
+		upper->count = block->count - half;
+		memcpy(BLOCK_DATA(upper), ELEMENT_UL(list, block, half), upper->count * list->elem_size);
+		block->count = half;
+		upper->next = block->next;
+		block->next = upper;
+		index_block_ul(list, pos + 1, upper, FIRST_UL(list, pos) + half);
+		if (list->tail == block) {
+			list->tail = upper;
+		} if (offset > half) {
+			block = upper;
+			offset -= half;
+			pos++;
+		}
+	}
+
+	memmove(ELEMENT_UL(list, block, offset + 1), ELEMENT_UL(list, block, offset), (block->count - offset) * list->elem_size);
+	list->deep_copyv(ELEMENT_UL(list, block, offset), data, list->elem_size);
+	block->count++;
+	list->size++;
+	shift_blocks_ul(list, pos, 1);
+	return 1;
+}
+
+// Removes the element at offset without freeing it, empty blocks are freed and a block that
+// dropped under half full is merged with the next block when both fit in one
+static void remove_element_ul(unrolled_list *list, ul_block *block, size_t pos, size_t offset) {
+	ul_block *prev = (pos == 0) ? NULL : list->blocks[pos - 1].block;
+	memmove(ELEMENT_UL(list, block, offset), ELEMENT_UL(list, block, offset + 1), (block->count - offset - 1) * list->elem_size);
+	block->count--;
+	list->size--;
+	shift_blocks_ul(list, pos, (size_t) -1);
+
+	if (block->count == 0) {
+		if (prev == NULL) {
+			list->head = block->next;
+		} else {
+			prev->next = block->next;
+		} if (list->tail == block) {
+			list->tail = prev;
+		}
+		unindex_block_ul(list, pos);
+		list->deallocate(block);
+		return;
+	}
+
+	ul_block *next = block->next;
+	if (next != NULL && block->count < list->block_capacity / 2 && block->count + next->count <= list->block_capacity) {
+		memcpy(ELEMENT_UL(list, block, block->count), BLOCK_DATA(next), next->count * list->elem_size);
+		block->count += next->count;
+		block->next = next->next;
+		if (list->tail == next) {
+			list->tail = block;
+		}
+		unindex_block_ul(list, pos + 1);
+		list->deallocate(next);
+	}
+}
+
+int delete_ul(unrolled_list *list, size_t index) {
+	if (index >= list->size) {
+		return 0;
+	}
+
+	size_t offset;
+	size_t pos;
+	ul_block *block = find_block_ul(list, index, &offset, &pos);
+	if (list->freev != NULL) {
+		list->freev(ELEMENT_UL(list, block, offset));
+	}
+	remove_element_ul(list, block, pos, offset);
+	return 1;
+}
+
+void *extract_ul(unrolled_list *list, size_t index) {
+	if (index >= list->size) {
+		return NULL;
+	}
+
+	size_t offset;
+	size_t pos;
+	ul_block *block = find_block_ul(list, index, &offset, &pos);
+	void *return_val = malloc (list->elem_size);
+	memcpy(return_val, ELEMENT_UL(list, block, offset), list->elem_size);
+	remove_element_ul(list, block, pos, offset);
+	return return_val;
+}
+
+void *extract_head_ul(unrolled_list *list) {
+	return extract_ul(list, 0);
+}
+
+void *get_data_ul(unrolled_list *list, size_t index) {
+	if (index >= list->size) {
+		return NULL;
+	}
+
+	size_t offset;
+	ul_block *block = find_block_ul(list, index, &offset, NULL);
+	return ELEMENT_UL(list, block, offset);
+}
+
+void print_ul(unrolled_list *list) {
+	if (list->printv == NULL) {
+		printf("Attempted to call print_ul without giving the unrolled list a print function!\nYou can do so by set_print_ul\n");
+		return;
+	}
+
+	size_t index = 0;
+	printf("\n----- ----- Unrolled List Start ----- -----\n");
+
+	for (ul_block *block = list->head; block != NULL; block = block->next) {
+		for (size_t i = 0; i < block->count; i++) {
+			printf("Index: %zu ", index++);
+			list->printv(ELEMENT_UL(list, block, i));
+		}
+	}
+
+	printf("\n----- ----- Unrolled List |End| ----- -----\n");
+}
+
+void map_ul(unrolled_list *list, void (*func)(void *)) {
+	for (ul_block *block = list->head; block != NULL; block = block->next) {
+		for (size_t i = 0; i < block->count; i++) {
+			func(ELEMENT_UL(list, block, i));
+		}
+	}
+}
+
+void *iter_ul(unrolled_list *new_unrolled_list) {
+	static ul_cursor cursor = {NULL, NULL, 0};
+	if (new_unrolled_list == NULL) {
+		return cursor_next_ul(&cursor);
+	}
+
+	cursor = cursor_begin_ul(new_unrolled_list);
+	return NULL;
+}
+
+ul_cursor cursor_begin_ul(unrolled_list *list) {
+	ul_cursor cursor = {list, list->head, 0};
+	return cursor;
+}
+
+void *cursor_next_ul(ul_cursor *cursor) {
+	ul_block *block = (ul_block*) cursor->block;
+	if (block == NULL) {
+		return NULL;
+	}
+
+	void *return_val = ELEMENT_UL(cursor->list, block, cursor->offset);
+	if (++cursor->offset == block->count) {
+		cursor->block = block->next;
+		cursor->offset = 0;
+	}
+	return return_val;
+}
+
+size_t get_index_ul(unrolled_list *list, void *value, size_t occurrence) {
+	if (value == NULL || !occurrence) {
+		return list->size;
+	}
+
+	size_t curr_index = 0;
+	for (ul_block *block = list->head; block != NULL; block = block->next) {
+		for (size_t i = 0; i < block->count; i++, curr_index++) {
+			if (!list->compare(ELEMENT_UL(list, block, i), value) && !--occurrence) {
+				return curr_index;
+			}
+		}
 	}
 
-	list->head = nodes[0];
-	list->tail = nodes[list->size - 1];
-	list->tail->next = NULL;
-	free(nodes);
-	free(next_nodes);
+	return list->size;
 }
 
-int is_sorted_ll(linked_list *list) {
+int is_sorted_ul(unrolled_list *list) {
 	if (list->size <= 1) {
 		return 1;
 	}
 
 	if (list->compare == NULL) {
-		printf("Called is_sorted_ll without giving the linked list a compare function?!\nSet it by set_compare_ll\n");
+		printf("Called is_sorted_ul without giving the unrolled list a compare function?!\nSet it by set_compare_ul\n");
 		return 0;
 	}
 
-	for (node *curr = list->head; curr->next != NULL; curr = curr->next) {
-		if (list->compare(curr->value, curr->next->value) == -1) {
-			return 0;
+	void *prev = NULL;
+	for (ul_block *block = list->head; block != NULL; block = block->next) {
+		for (size_t i = 0; i < block->count; i++) {
+			if (prev != NULL && list->compare(prev, ELEMENT_UL(list, block, i)) < 0) {
+				return 0;
+			}
+			prev = ELEMENT_UL(list, block, i);
 		}
 	}
 
 	return 1;
 }
 
+// Sorts in the same order as merge_sort_ll, the elements are merge sorted by address then copied back in order
+void merge_sort_ul(unrolled_list *list) {
+	if (list->size <= 1) {
+		return;
+	}
 
-size_t get_index_ll(linked_list *list, void *value, size_t occurrence) { // returns 0 <= x < size if successfull else returns size
-	if (list == NULL || value == NULL || !occurrence) {
-		return list->size;
+	if (list->compare == NULL) {
+		printf("Called merge_sort_ul without giving the unrolled list a compare function?!\nSet it by set_compare_ul\n");
+		return;
 	}
 
-	size_t curr_index = 0;
-	node *curr = list->head;
+	char **elements = (char **) malloc (list->size * sizeof(char *));
+	char **next_elements = (char **) malloc (list->size * sizeof(char *));
+	char **temp_elements;
+	size_t k = 0;
 
-	while (curr) {
-		if (!list->compare(curr->value, value)) {
-			occurrence--;
-			if (!occurrence) {
-				return curr_index;
+	for (ul_block *block = list->head; block != NULL; block = block->next) {
+		for (size_t i = 0; i < block->count; i++) {
+			elements[k++] = ELEMENT_UL(list, block, i);
+		}
+	}
+
+	size_t i, j, mid, end;
+	for (size_t subsize = 1; subsize < list->size; subsize <<= 1) {
+		for (size_t start = 0; start < list->size; start += subsize << 1) {
+			mid = (start + subsize < list->size) ? start + subsize : list->size;
+			end = (mid + subsize < list->size) ? mid + subsize : list->size;
+			i = k = start;
+			j = mid;
+			while (i < mid && j < end) {
+				next_elements[k++] = (list->compare(elements[i], elements[j]) >= 0) ? elements[i++] : elements[j++];
+			}
+			while (i < mid) {
+				next_elements[k++] = elements[i++];
+			}
+			while (j < end) {
+				next_elements[k++] = elements[j++];
 			}
 		}
-		curr = curr->next;
-		curr_index++;
+		temp_elements = elements;
+		elements = next_elements;
+		next_elements = temp_elements;
 	}
 
-	return list->size;
+	char *sorted = (char *) malloc (list->size * list->elem_size);
+	for (k = 0; k < list->size; k++) {
+		memcpy(sorted + k * list->elem_size, elements[k], list->elem_size);
+	}
+
+	k = 0;
+	for (ul_block *block = list->head; block != NULL; block = block->next) {
+		memcpy(BLOCK_DATA(block), sorted + k * list->elem_size, block->count * list->elem_size);
+		k += block->count;
+	}
+
+	free(sorted);
+	free(elements);
+	free(next_elements);
 }
 
-void **get_as_array_ll(linked_list *list) { // Still need to free the linked list and the array, be careful if the data contains pointers to elsewhere the data is deep copied.
-	if (list == NULL) {
-		return NULL;
+void reverse_ul(unrolled_list *list) {
+	if (list->size <= 1) {
+		return;
 	}
 
-	void **array = malloc (list->size * sizeof(void *));
-	node *curr = list->head;
-	size_t i = 0;
+	char *temp = (char *) malloc (list->elem_size);
+	ul_block *prev = NULL;
+	ul_block *block = list->head;
+	ul_block *next;
 
-	while (curr != NULL) {
-		array[i] = malloc (curr->val_size);
-		list->deep_copyv(array[i], curr->value, curr->val_size);
-		i++; curr = curr->next;
+	while (block != NULL) {
+		for (size_t i = 0, j = block->count - 1; i < j; i++, j--) {
+			memcpy(temp, ELEMENT_UL(list, block, i), list->elem_size);
+			memcpy(ELEMENT_UL(list, block, i), ELEMENT_UL(list, block, j), list->elem_size);
+			memcpy(ELEMENT_UL(list, block, j), temp, list->elem_size);
+		}
+		next = block->next;
+		block->next = prev;
+		prev = block;
+		block = next;
 	}
 
-	return array;
+	list->tail = list->head;
+	list->head = prev;
+	reindex_blocks_ul(list);
+	free(temp);
 }
 
-void **convert_to_array_ll(linked_list *list) { // This one creates the array while freeing the linked list
-	if (list == NULL) {
+unrolled_list *slice_unrolled_list(unrolled_list *list, size_t start, size_t end, void *(*allocator_p)(size_t)) {
+	if (end < start) {
+		printf("Start index cannot be greater than end index...\n");
 		return NULL;
+	} else if (end >= list->size) {
+		return NULL; // No message here
 	}
 
-	void **array = malloc (list->size * sizeof(void *));
-	node *curr = list->head;
-	node *prev = NULL;
-	list->head = NULL;
-	size_t i = 0;
+	unrolled_list *new_list = new_unrolled_list(list->elem_size, list->block_capacity, (allocator_p) ? allocator_p : list->allocate);
+	new_list->printv = list->printv;
+	new_list->freev = list->freev;
+	new_list->deep_copyv = list->deep_copyv;
+	new_list->deallocate = list->deallocate;
+	new_list->compare = list->compare;
 
-	while (curr != NULL) {
-		array[i] = malloc (curr->val_size);
-		list->deep_copyv(array[i], curr->value, curr->val_size);
-		list->freev(curr->value);
-		prev = curr;
-		i++; curr = curr->next;
-		free(prev);
+	size_t offset;
+	ul_block *block = find_block_ul(list, start, &offset, NULL);
+	for (size_t i = start; i <= end; i++) {
+		append_ul(new_list, ELEMENT_UL(list, block, offset));
+		if (++offset == block->count) {
+			block = block->next;
+			offset = 0;
+		}
 	}
 
-	free(list);
-	return array;
+	return new_list;
 }
 
-linked_list *array_to_linked_list(void **array, size_t size_of_array, size_t size_of_value, void *(*allocator_p)(size_t), void (*freev)(void *)) { // Assumes array is already stored on heap
-	linked_list *list = new_linked_list(allocator_p);
-	list->freev = (freev == NULL) ? free : freev;
-
-	if (array == NULL) {
-		return list;
+void combine_ul(unrolled_list *combined, unrolled_list *freed) {
+	if (combined->elem_size != freed->elem_size) {
+		printf("Attempted to combine unrolled lists with different element sizes! The freed list is freed without being added\n");
+		free_unrolled_list(freed);
+		return;
 	}
 
-	list->head = (node *) list->allocate (sizeof(node));
-	list->head->value = list->allocate (size_of_value);
-	memcpy(list->head->value, array[0], size_of_value);
-	list->head->val_size = size_of_value;
-	list->freev(array[0]);
-	list->tail = list->head;
-
-	for (size_t i = 1; i < size_of_array; i++) {
-		list->tail->next = (node *) list->allocate (sizeof(node));
-		list->tail->next->value = list->allocate (size_of_value);
-		memcpy(list->tail->next->value, array[i], size_of_value);
-		list->tail->next->val_size = size_of_value;
-		list->freev(array[i]);
-		list->tail = list->tail->next;
+	if (combined->block_capacity != freed->block_capacity) { // The blocks do not fit, so the elements are moved into new ones
+		for (ul_block *block = freed->head; block != NULL; block = block->next) {
+			for (size_t i = 0; i < block->count; i++) {
+				memcpy(append_slot_ul(combined), ELEMENT_UL(freed, block, i), combined->elem_size);
+			}
+		}
+		freed->freev = NULL; // The elements were moved, what they point to now belongs to combined
+		free_unrolled_list(freed);
+		return;
 	}
-	list->tail->next = NULL;
-	list->size = size_of_array;
 
-	free(array);
-	return list;
+	if (combined->tail == NULL) {
+		combined->head = freed->head;
+	} else {
+		combined->tail->next = freed->head;
+	} if (freed->tail != NULL) {
+		combined->tail = freed->tail;
+	}
+	for (size_t pos = 0; pos < freed->block_count; pos++) {
+		index_block_ul(combined, combined->block_count, freed->blocks[pos].block, combined->size + FIRST_UL(freed, pos));
+	}
+	combined->size += freed->size;
+	freed->head = freed->tail = NULL;
+	freed->size = 0;
+	free_unrolled_list(freed);
 }
 
-linked_list *array_as_linked_list(void **array, size_t size_of_array, size_t size_of_value, void *(*allocator_p)(size_t), void (*freev)(void*)) {// Assumes array is already stored on heap does not free array
-	linked_list *list = new_linked_list(allocator_p);
-	list->freev = (freev == NULL) ? free : freev;
+typedef struct cl_block {
+	struct cl_block *next;
+	size_t count; // Values stored in this block
+	size_t used; // Bytes of data used
+	int first; // First value of the block, the rest are stored as varint deltas
+	int last; // Last value of the block so appending does not decode the block
+} cl_block;
 
-	if (array == NULL) {
-		return list;
-	}
+typedef struct compressed_list {
+	size_t size;
+	size_t block_bytes; // Bytes of encoded deltas a block can hold
+	size_t blocks;
+	void *(*allocate)(size_t size);
+	void (*deallocate)(void *);
+	cl_block *head;
+	cl_block *tail;
+} compressed_list;
 
-	list->head = (node *) list->allocate (sizeof(node));
-	list->head->value = list->allocate (size_of_value);
-	memcpy(list->head->value, array[0], size_of_value);
-	list->head->val_size = size_of_value;
-	list->tail = list->head;
+#define BLOCK_DELTAS(block) ((unsigned char*) (block) + ALIGN_UP(sizeof(cl_block)))
 
-	for (size_t i = 1; i < size_of_array; i++) {
-		list->tail->next = (node *) list->allocate (sizeof(node));
-		list->tail->next->value = list->allocate (size_of_value);
-		memcpy(list->tail->next->value, array[i], size_of_value);
-		list->tail->next->val_size = size_of_value;
-		list->tail = list->tail->next;
-	}
-	list->tail->next = NULL;
-	list->size = size_of_array;
+// Longest varint of a 64 bit delta
+#define MAX_VARINT 10
 
-	return list;
+compressed_list *new_compressed_list(size_t block_bytes, void *(*allocator_p)(size_t)) {
+	void *(*allocator)(size_t) = (allocator_p == NULL) ? malloc : allocator_p;
+	compressed_list *new_list = (compressed_list*) allocator (sizeof(compressed_list));
+	new_list->size = 0;
+	new_list->block_bytes = (block_bytes < MAX_VARINT) ? 256 : block_bytes;
+	new_list->blocks = 0;
+	new_list->allocate = allocator;
+	new_list->deallocate = free;
+	new_list->head = NULL;
+	new_list->tail = NULL;
+	return new_list;
 }
 
+void set_deallocater_cl(compressed_list *list, void (*deallocate_p)(void *)) {
+	list->deallocate = deallocate_p;
+}
 
-int internal_check_ll(linked_list *list, int fix) {// returns amount of tests failed 0 - 2
-	printf("##### ##### ##### START OF INTERNAL CHECK ##### ##### #####\n");
-	printf("_____ Function Addresses _____\n");
-	printf("printv address:     %p\n", list->printv);
-	printf("freev address:      %p\n", list->freev);
-	printf("deep_copyv address: %p\n", list->deep_copyv);
-	printf("allocate address:   %p\n", list->allocate);
-	printf("compare address:    %p\n", list->compare);
-	printf("list head address:  %p\n\n", list->head);
-
-	char tests_passed = 0;
-	size_t size = 0;
-	node *curr = list->head;
+size_t get_size_cl(compressed_list *list) {
+	return list->size;
+}
 
-	if (curr != NULL) {
-		while (curr->next != NULL) {
-			size++;
-			curr = curr->next;
-		}
-		size++;
-	}
-	
-	printf("_____ Tail and Size Tests _____\n");
-	printf("Stored list size:  %zu\n", list->size);
-	printf("Checked list size: %zu\n", size);
-	if (list->size == size) {
-		tests_passed++;
-		printf("-> Size test passed!\n");
-	} else {
-		printf("-> Size test failed!\n");
-	}
-	
-	printf("Stored tail address:  %p\n", list->tail);
-	printf("Checked tail address: %p\n", curr);
-	if (curr == list->tail) {
-		tests_passed++;
-		printf("-> Tail test passed!\n");
-	} else {
-		printf("-> Tail test failed!\n");
+void empty_cl(compressed_list *list) {
+	cl_block *block = list->head;
+	cl_block *next;
+	while (block != NULL) {
+		next = block->next;
+		list->deallocate(block);
+		block = next;
 	}
-	
-	printf("\n_____ Overview _____\n");
-	printf("%d/2 Tests passed\n\n", tests_passed);
+	list->head = list->tail = NULL;
+	list->size = 0;
+	list->blocks = 0;
+}
 
-	if (fix) {
-		list->size = size;
-		list->tail = curr;
-		printf("Size and tail set to what was found during check.\n");
-	} else if (tests_passed != 2) {
-		printf("Failed tests not fixed.\nIf you want to fix them use fix_ll or this function with the fix parameter set to a non zero value.\n");
-	}
-	printf("##### ##### ##### -END- OF INTERNAL CHECK ##### ##### #####\n");
+void free_compressed_list(compressed_list *list) {
+	empty_cl(list);
+	list->deallocate(list);
+}
 
-	return 2 - tests_passed;
+// Zigzag encodes the delta so small negative deltas also take few bytes, returns the bytes written
+static size_t encode_delta_cl(unsigned char *out, long long delta) {
+	unsigned long long zigzag = ((unsigned long long) delta << 1) ^ (unsigned long long) (delta >> 63);
+	size_t used = 0;
+	while (zigzag >= 0x80) {
+		out[used++] = (unsigned char) (zigzag | 0x80);
+		zigzag >>= 7;
+	}
+	out[used++] = (unsigned char) zigzag;
+	return used;
 }
 
-void fix_ll(linked_list *list, int display_fix_message) {
-	node *curr = list->head;
-	size_t size = 0;
+// Decodes the delta at in and adds it to value, returns the bytes read
+static size_t decode_delta_cl(const unsigned char *in, int *value) {
+	unsigned long long zigzag = 0;
+	size_t used = 0;
+	int shift = 0;
+	do {
+		zigzag |= (unsigned long long) (in[used] & 0x7f) << shift;
+		shift += 7;
+	} while (in[used++] & 0x80);
+	*value = (int) (*value + (long long) ((zigzag >> 1) ^ (~(zigzag & 1) + 1)));
+	return used;
+}
 
-	if (curr != NULL) {
-		while (curr->next != NULL) {
-			size++;
-			curr = curr->next;
+size_t append_cl(compressed_list *list, int value) {
+	if (list->tail == NULL || list->tail->used + MAX_VARINT > list->block_bytes) {
+		cl_block *block = (cl_block*) list->allocate (ALIGN_UP(sizeof(cl_block)) + list->block_bytes);
+		block->next = NULL;
+		block->count = 1;
+		block->used = 0;
+		block->first = block->last = value;
+		if (list->tail == NULL) {
+			list->head = block;
+		} else {
+			list->tail->next = block;
 		}
-		size++;
+		list->tail = block;
+		list->blocks++;
+		return list->size++;
 	}
 
-	if (display_fix_message) {
-		if (size != list->size) {
-			printf("Previous size: %zu\n", list->size);
-			printf("Fixed size:    %zu\n", size);
-		} if (curr != list->tail) {
-			printf("Previous tail: %p\n", list->tail);
-			printf("Fixed tail:    %p\n", curr);
+	list->tail->used += encode_delta_cl(BLOCK_DELTAS(list->tail) + list->tail->used, (long long) value - list->tail->last);
+	list->tail->last = value;
+	list->tail->count++;
+	return list->size++;
+}
+
+// A compressed list cannot be changed in place so there is no pointer to return, out of range indexes give 0
+int get_int_val_cl(compressed_list *list, size_t index) {
+	cl_block *block = list->head;
+	if (index >= list->size) {
+		return 0;
+	} if (index >= list->size - list->tail->count) {
+		index -= list->size - list->tail->count;
+		if (index == list->tail->count - 1) {
+			return list->tail->last;
 		}
+		block = list->tail;
 	}
 
-	list->size = size;
-	list->tail = curr;
-}
+	while (index >= block->count) {
+		index -= block->count;
+		block = block->next;
+	}
 
-void combine_ll(linked_list *combined, linked_list *freed) {
-	combined->tail->next = freed->head;
-	combined->size += freed->size;
-	combined->tail = freed->tail;
-	free(freed);
+	int value = block->first;
+	const unsigned char *in = BLOCK_DELTAS(block);
+	for (size_t i = 0; i < index; i++) {
+		in += decode_delta_cl(in, &value);
+	}
+	return value;
 }
 
-int get_int_val_ll(linked_list *list, size_t index) {
-	return *(int*) get_data_ll(list, index);
-}
+void *iter_cl(compressed_list *new_compressed_list) {
+	static cl_cursor cursor = {NULL, 0, 0, 0};
+	if (new_compressed_list == NULL) {
+		return cursor_next_cl(&cursor);
+	}
 
-unsigned int get_uint_val_ll(linked_list *list, size_t index) {
-	return *(unsigned int*) get_data_ll(list, index);
+	cursor = cursor_begin_cl(new_compressed_list);
+	return NULL;
 }
 
-long get_long_val_ll(linked_list *list, size_t index) {
-	return *(long*) get_data_ll(list, index);
+cl_cursor cursor_begin_cl(compressed_list *list) {
+	cl_cursor cursor = {list->head, 0, 0, 0};
+	return cursor;
 }
 
-unsigned long get_ulong_val_ll(linked_list *list, size_t index) {
-	return *(unsigned long*) get_data_ll(list, index);
-}
+int *cursor_next_cl(cl_cursor *cursor) {
+	cl_block *block = (cl_block*) cursor->block;
+	if (block == NULL) {
+		return NULL;
+	}
 
-short get_short_val_ll(linked_list *list, size_t index) {
-	return *(short*) get_data_ll(list, index);
+	if (cursor->offset == 0) {
+		cursor->value = block->first;
+	} else {
+		cursor->used += decode_delta_cl(BLOCK_DELTAS(block) + cursor->used, &cursor->value);
+	} if (++cursor->offset == block->count) {
+		cursor->block = block->next;
+		cursor->offset = cursor->used = 0;
+	}
+	return &cursor->value;
 }
 
-unsigned short get_ushort_val_ll(linked_list *list, size_t index) {
-	return *(unsigned short*) get_data_ll(list, index);
-}
+size_t get_index_cl(compressed_list *list, int value, size_t occurrence) {
+	if (!occurrence) {
+		return list->size;
+	}
 
-float get_float_val_ll(linked_list *list, size_t index) {
-	return *(float*) get_data_ll(list, index);
-}
+	size_t curr_index = 0;
+	int curr;
+	for (cl_block *block = list->head; block != NULL; block = block->next) {
+		const unsigned char *in = BLOCK_DELTAS(block);
+		curr = block->first;
+		for (size_t i = 0; i < block->count; i++, curr_index++) {
+			if (i != 0) {
+				in += decode_delta_cl(in, &curr);
+			} if (curr == value && !--occurrence) {
+				return curr_index;
+			}
+		}
+	}
 
-double get_double_val_ll(linked_list *list, size_t index) {
-	return *(double*) get_data_ll(list, index);
+	return list->size;
 }
 
-char get_char_val_ll(linked_list *list, size_t index) {
-	return *(char*) get_data_ll(list, index);
+// Same order as merge_sort_ll with a compare function that returns 1 when a > b
+static int compare_descending_cl(const void *a, const void *b) {
+	int aa = *(const int*) a;
+	int bb = *(const int*) b;
+	return (aa < bb) - (aa > bb);
 }
 
-unsigned char get_uchar_val_ll(linked_list *list, size_t index) {
-	return *(unsigned char*) get_data_ll(list, index);
-}
+void merge_sort_cl(compressed_list *list) {
+	if (list->size <= 1) {
+		return;
+	}
 
-char *get_str_val_ll(linked_list *list, size_t index) {
-	return *(char**) get_data_ll(list, index);
+	int *values = (int *) malloc (list->size * sizeof(int));
+	size_t size = list->size;
+	size_t i = 0;
+	cl_cursor cursor = cursor_begin_cl(list);
+	int *value;
+
+	while ((value = cursor_next_cl(&cursor)) != NULL) {
+		values[i++] = *value;
+	}
+
+	qsort(values, size, sizeof(int), compare_descending_cl);
+	empty_cl(list);
+	for (i = 0; i < size; i++) {
+		append_cl(list, values[i]);
+	}
+	free(values);
 }
 
+size_t get_memory_cl(compressed_list *list) {
+	return HEAP_BLOCK(sizeof(compressed_list)) + list->blocks * HEAP_BLOCK(ALIGN_UP(sizeof(cl_block)) + list->block_bytes);
+}
 
+double get_compression_ratio_cl(compressed_list *list) {
+	if (list->size == 0) {
+		return 0;
+	}
+	return (double) (list->size * (HEAP_BLOCK(sizeof(sized_node)) + HEAP_BLOCK(sizeof(int)))) / get_memory_cl(list);
+}
@@ -7,6 +7,31 @@
 */
 typedef struct linked_list linked_list;
 
+// Handle to a node of a linked list, stays valid until that node is removed or the list is relinked by
+// merge_sort_ll, defragment_ll, combine_ll or splice_ll (when the lists store nodes differently). A NULL target is the null handle
+// Compile linked_list.c with -DLL_DEBUG_HANDLES to have handles to removed nodes reported
+typedef struct ll_handle {
+	void *target;
+	size_t generation;
+} ll_handle;
+
+// Position of an iteration over a linked list, made by cursor_begin_ll and kept on the stack of the caller
+// Any number of cursors can be used at the same time, also from different threads as long as no one changes the list
+typedef struct ll_cursor {
+	linked_list *list;
+	void *prev; // Node before the current one, NULL at the head
+	void *curr; // Node of the value last returned by cursor_next_ll, NULL before the first one or after a removal
+} ll_cursor;
+
+// Memory a linked list uses, returned by get_memory_stats_ll
+typedef struct ll_memory_stats {
+	size_t node_bytes; // Bytes of the node headers (next, value pointer and value size)
+	size_t value_bytes; // Bytes of the stored values
+	size_t allocations; // Calls made to the allocate function, counting slabs of pools and arenas
+	size_t deallocations; // Calls made to the deallocate or free function
+	size_t overhead_bytes; // Estimated bytes lost to allocator headers, alignment and unused slab space
+} ll_memory_stats;
+
 /*
 
 IMPORTANT NOTES:
@@ -16,7 +41,8 @@ All functions that have linked_list in the name instead of ll either create a ne
 Remember to free all linked lists with free_linked_list and remember to free extracts
 
 When a linked list is created it has no print or compare function but the deep copy function
-defaults to memcpy the free function defaults to free and that allocate function defaults to malloc
+defaults to memcpy the free function defaults to free, the allocate function defaults to malloc
+and the deallocate function defaults to free
 
 malloc is not checked for failure
 
@@ -25,6 +51,13 @@ malloc is not checked for failure
 // Constructor for linked list, you can send in an allocator function or you can use NULL, defaults to malloc
 linked_list *new_linked_list(void *(*allocator_p)(size_t));
 
+// Constructor for a linked list where every value is elem_size bytes, nodes do not store their own value size
+// and plain copies of common sizes skip the call to the deep copy function
+// Functions taking a data_size ignore it and use elem_size instead
+// The 8 bytes saved per node show up in co-allocated, pooled and arena lists. Nodes allocated on their own are small
+// enough that malloc rounds both layouts to the same block, so there it saves neither memory nor time
+linked_list *new_fixed_linked_list(size_t elem_size, void *(*allocator_p)(size_t));
+
 // Sets the function that frees the data the link lists holds, must be set if the data being held
 // contains pointers to other memory that needs to be freed
 void set_free_ll(linked_list *list, void (*free_p)(void *));
@@ -39,9 +72,68 @@ void set_deep_copy_ll(linked_list *list, void *(*deep_copy_p)(void * restrict de
 // Sets the allocater function for data the linked list will store
 void set_allocater_ll(linked_list *list, void *(allocate_p)(size_t size));
 
+// Sets the function that gives memory from the allocater back, used for nodes, the linked list struct and
+// values when the free function is left as the default
+void set_deallocater_ll(linked_list *list, void (*deallocate_p)(void *));
+
 // Sets the compare function that will be used to compare data stored
 void set_compare_ll(linked_list *list, int (*compare_p)(const void *a, const void *b));
 
+// Set co_allocate to 1 to store each value in the same allocation as its node, halving the allocations
+// per element. Lists are not co-allocated unless this, set_pool_ll or set_arena_ll is called or they are string lists
+// Only works on an empty list, returns 1 if the mode was set else 0
+// When co-allocated the free function must only free what the data points to, not the data itself
+// (the default free is skipped). Extracted values can still be freed with free: with the default malloc and free the
+// value is moved to the start of its node and the node is handed out without allocating, otherwise it is copied out
+int set_co_allocate_ll(linked_list *list, int co_allocate);
+
+// Set deque to 1 to have every node also point to the node before it (8 more bytes per node). Deleting or extracting
+// the tail and removing or stepping back from a handle become O(1), and reverse_ll only flips the direction of the list
+// in O(1), the links are turned around by the next function walking the list. With a skip or hash index reverse_ll
+// turns them around right away to rebuild the indexes, which is O(n). Only works on an empty list and
+// drops a pool set by set_pool_ll, returns 1 if the mode was set else 0
+int set_deque_ll(linked_list *list, int deque);
+
+// Set use_index to 1 to keep a skip index of the positions in the list, making get_data_ll, insert_ll, delete_ll,
+// extract_ll and slice_linked_list O(log n) instead of O(n) at the cost of about 16 bytes per node
+// Functions that already walk the whole list (reverse_ll, the sorts, filter_ll, combine_ll, seperate_linked_list,
+// delete_many_ll, defragment_ll, ...) rebuild the index in O(n) before they return. After splice_ll, split_at_ll,
+// append_many_ll or prepend_many_ll it is out of date until the next insert_ll, delete_ll or extract_ll or a call to
+// prepare_ll, until then get_data_ll and slice_linked_list walk the list. Set it to 0 to free the index, always returns 1
+int set_skip_index_ll(linked_list *list, int use_index);
+
+// Keeps a hash table of the values in the list so get_index_ll and contains_ll are O(1) on average. Values that compare
+// equal must get the same hash from hash_p, pass NULL to free the index. Needs a compare function, returns 1 if set else 0
+// Appending, prepending and extracting the head keep the positions up to date in O(1). Inserting or removing in the middle
+// is noted in a log that lookups replay, once it holds about twice the square root of the size edits the next insert or
+// delete renumbers the positions in O(n), so lookups stay O(sqrt n) at worst. Functions that relink the whole list and
+// splice_ll rebuild the table before they return, only between the steps of sort_step_ll are lookups left to scan
+// Values must not be changed through get_data_ll while they are indexed
+int set_hash_index_ll(linked_list *list, size_t (*hash_p)(const void *value));
+
+// Rebuilds whatever a function that relinked the list left out of date: the skip and hash index, the previous pointers
+// and the links of a reversed deque list. Functions that only read the list (get_data_ll, get_index_ll, contains_ll,
+// the cursors, ...) never write to it, so they can be called from several threads at once as long as no one changes
+// the list, and they only use the indexes that are up to date. Functions that walk the whole list already rebuild the
+// indexes before they return, call this after the ones that do not (see set_skip_index_ll) to make reads fast again
+void prepare_ll(linked_list *list);
+
+// Makes the list take its nodes from a pool of slabs each holding slab_nodes nodes, every node has room for
+// value_size bytes of co-allocated value (bigger values get their own allocation). Deleted nodes are kept on
+// a free list and reused so steady appending and removing does not call the allocater
+// Slabs come from the current allocater and deallocater. Only works on an empty list, returns 1 if set else 0
+// The pool is shared with lists made by seperate, split and by clone and slice without an allocator, and freed with
+// the last of them. The pool has no lock, so lists sharing it must not be changed from different threads at the same
+// time. Give clone or slice an allocator to get a list with a pool of its own (string lists still share their strings)
+// Co-allocation rules apply, see set_co_allocate_ll
+int set_pool_ll(linked_list *list, size_t value_size, size_t slab_nodes);
+
+// Makes the list bump allocate its nodes and values from chunks of at least chunk_size bytes
+// Deleted nodes are not given back until the list is emptied or freed, then whole chunks are released at once
+// and if the free function is the default the nodes are not even visited, so scratch lists are dropped in O(1)
+// Only works on an empty list, returns 1 if set else 0. Co-allocation rules apply, see set_co_allocate_ll
+int set_arena_ll(linked_list *list, size_t chunk_size);
+
 // Returns a size_t representing how many elements are in the linked list
 size_t get_size_ll(linked_list *list);
 
@@ -63,6 +155,63 @@ size_t append_ll(linked_list *list, void *data, size_t data_size);
 // Adds data to the given index of the linked list O(n)
 int insert_ll(linked_list *list, void *data, size_t data_size, size_t index);
 
+// The adopt versions of prepend_ll, append_ll and insert_ll take ownership of data instead of copying it
+// data must come from the allocate function of the list (malloc by default) as the list frees it like its own values
+// and must not be used or freed by the caller afterwards, unless insert_adopt_ll returned 0. Only the node is allocated
+// and co-allocated lists store the value outside of it
+void prepend_adopt_ll(linked_list *list, void *data, size_t data_size);
+
+size_t append_adopt_ll(linked_list *list, void *data, size_t data_size);
+
+int insert_adopt_ll(linked_list *list, void *data, size_t data_size, size_t index);
+
+// Copies count values of elem_size bytes each from the contiguous buffer to the end or start of the linked list
+// The new nodes are linked together first and spliced in at once, pooled and arena lists carve all of them out of
+// one allocation. Heap lists still make one allocation per node, two if they are not co-allocated, because delete_ll
+// frees every node on its own and can not give back part of a block, call set_pool_ll or set_arena_ll first or use
+// buffer_to_linked_list to get one allocation per batch. elem_size must match a fixed element size
+// Returns the number of values added
+size_t append_many_ll(linked_list *list, const void *buffer, size_t count, size_t elem_size);
+
+size_t prepend_many_ll(linked_list *list, const void *buffer, size_t count, size_t elem_size);
+
+// The handle versions of prepend_ll, append_ll and insert_ll return a handle to the new node
+// insert_handle_ll returns the null handle if the index is out of range
+ll_handle prepend_handle_ll(linked_list *list, void *data, size_t data_size);
+
+ll_handle append_handle_ll(linked_list *list, void *data, size_t data_size);
+
+ll_handle insert_handle_ll(linked_list *list, void *data, size_t data_size, size_t index);
+
+// Handle to the head, the null handle if the list is empty
+ll_handle head_handle_ll(linked_list *list);
+
+// Handle to the tail, the null handle if the list is empty
+ll_handle tail_handle_ll(linked_list *list);
+
+// Handle to the node after the node of handle, the null handle after the tail. Iterate with
+// for (ll_handle h = head_handle_ll(list); h.target != NULL; h = next_handle_ll(list, h))
+ll_handle next_handle_ll(linked_list *list, ll_handle handle);
+
+// Handle to the node before the node of handle, the null handle before the head. O(1) for deque lists else O(n)
+ll_handle prev_handle_ll(linked_list *list, ll_handle handle);
+
+// Returns the void * to the data of the node of handle, NULL for the null handle
+void *get_handle_data_ll(ll_handle handle);
+
+// Adds data after the node of handle in O(1), the null handle adds it in front of the list. Returns a handle to the new node
+// With a skip or hash index the index of the node is needed to keep them up to date. It is known for the ends, the
+// nodes last reached by index or inserted after (so inserting after the returned handle again stays known), and
+// nodes found in a hash index, the skip index is then updated in O(log n). Otherwise, which only happens without a hash
+// index, the skip index is marked out of date, see prepare_ll. erase_after_ll works the same
+ll_handle insert_after_ll(linked_list *list, ll_handle handle, void *data, size_t data_size);
+
+// Deletes the node after the node of handle in O(1), the null handle deletes the head. Returns 1 if a node was deleted else 0
+int erase_after_ll(linked_list *list, ll_handle handle);
+
+// Deletes the node of handle, O(1) for deque lists else O(n). Returns 1 if a node was deleted else 0
+int remove_handle_ll(linked_list *list, ll_handle handle);
+
 // Deletes whats at given index
 int delete_ll(linked_list *list, size_t index);
 
@@ -70,21 +219,40 @@ int delete_ll(linked_list *list, size_t index);
 // Must be freed
 void *extract_head_ll(linked_list *list);
 
+// Copies the value at the head into destination and deletes the head node, no allocation is made
+// destination must have room for the value. Returns 1 if a value was copied, 0 if the list is empty
+int extract_head_into_ll(linked_list *list, void *destination);
+
 // Returns the void * to value at given index and deletes the node
 // Must be freed
 void *extract_ll(linked_list *list, size_t index);
 
+// Returns the void * to value at the tail and deletes the node, O(1) for deque lists
+// Must be freed
+void *extract_tail_ll(linked_list *list);
+
+// Deletes the nodes at the given indexes in one pass, the indexes are the ones from before the call so they do not shift
+// between deletes. The indexes may be unsorted, duplicates and indexes out of range are skipped. Returns the amount deleted
+size_t delete_many_ll(linked_list *list, const size_t *indexes, size_t count);
+
+// Extracts the values at the given indexes in one pass like delete_many_ll, the array holds the values in index order
+// and the amount is put in extracted. The array and each value must be freed
+void **extract_many_ll(linked_list *list, const size_t *indexes, size_t count, size_t *extracted);
+
 // Displays all contents of the linked list make sure print function is set
 void print_ll(linked_list *list);
 
 // Deep copies the linked list and returns it, optional: send in an allocator method
-// You can put NULL it will default to the original lists allocator
+// You can put NULL it will default to the original lists allocator and deallocater and share its pool if it has one
+// With an allocator the struct, the nodes and a new pool of the same shape come from it, the deallocater is reset
+// to free so set it with set_deallocater_ll if the allocator needs another one
 linked_list *clone_linked_list(linked_list *list, void *(*allocator_p)(size_t));
 
-// (In place) Reverses the nodes of the linked list
+// (In place) Reverses the nodes of the linked list, O(1) for deque lists (see set_deque_ll)
 void reverse_ll(linked_list *list);
 
 // Returns the void * to the data at given index, unlike extract it does not remove the node and it still in the linked list
+// Each thread remembers the last index it read from the list so looping over the indexes in order is O(n) in total
 void *get_data_ll(linked_list *list, size_t index);
 
 // Applies a given function to every element in the linked list
@@ -99,8 +267,23 @@ void filter_ll(linked_list *list, int (*func)(void *));
 // where NULL would be returned at the end.
 void *iter_ll(linked_list *new_linked_list);
 
+// Reentrant version of iter_ll, returns a cursor before the first value of the linked list
+// The list should only be changed through cursor_remove_ll while the cursor is in use
+ll_cursor cursor_begin_ll(linked_list *list);
+
+// Moves the cursor to the next value and returns it, NULL when the end of the linked list is reached
+void *cursor_next_ll(ll_cursor *cursor);
+
+// Returns the value cursor_next_ll would return without moving the cursor
+void *cursor_peek_ll(ll_cursor *cursor);
+
+// Deletes the value last returned by cursor_next_ll in O(1), the next call to cursor_next_ll returns the value after it
+// Returns 1 if a value was deleted, 0 if the cursor is before the first value, at the end or its value was already deleted
+int cursor_remove_ll(ll_cursor *cursor);
+
 // Deep copies the start < end indexed nodes into a new linked list
 // allocator_p can be used to send in your own allocator else it will use the allocator from the given linked list
+// The storage works the same as for clone_linked_list
 linked_list *slice_linked_list(linked_list* list, size_t start, size_t end, void *(*allocator_p)(size_t));
 
 // Seperated the linked list into a new one based on the given function, allocator_p can be used to send in your own allocator for the returned linked_list struct else it will use the allocator from
@@ -112,18 +295,77 @@ linked_list *seperate_linked_list(linked_list *list, int(*func)(void *), void *(
 // Merge sorts the linked list, compare function must be set O(n log(n))
 void merge_sort_ll(linked_list *list);
 
+// Merge sorts the linked list with up to thread_count threads (0 uses one per online processor), giving the exact same
+// order as merge_sort_ll. Chunks are sorted at the same time and then merged with the outputs split among the threads,
+// which are made once per call and take the jobs of every round
+// The compare function is called from several threads at once, small lists are sorted by merge_sort_ll
+void parallel_merge_sort_ll(linked_list *list, size_t thread_count);
+
+// Merge sorts the linked list into the same order as merge_sort_ll by relinking the nodes in place
+// Needs O(1) extra memory and allocates nothing, for big lists where the arrays of merge_sort_ll do not fit
+// It is slower than merge_sort_ll: 5 million random ints take 1.5 to 1.8 times as long, because every merge step waits
+// on the next node and its value while merge_sort_ll reads them from an array, so only use it when memory is short
+void merge_sort_in_place_ll(linked_list *list);
+
+// State of a merge sort done a little at a time, for callers that can not block for the whole sort
+typedef struct ll_sort ll_sort;
+
+// Starts sorting the linked list into the same order as merge_sort_ll, returns NULL without a compare function
+// Until sort_finish_ll is called the list must only be read, it stays a valid list with the same size and values
+// between steps but is only sorted once sort_step_ll returned 1
+ll_sort *sort_begin_ll(linked_list *list);
+
+// Sorts for at most budget calls of the compare function, returns 1 once the list is sorted else 0
+// Sorting n values takes about n log(n) comparisons in total, O(1) extra memory
+int sort_step_ll(ll_sort *sort, size_t budget);
+
+// Does whatever is left of the sort and frees sort
+void sort_finish_ll(ll_sort *sort);
+
+// Merge sorts the linked list into the same order as merge_sort_ll but starts from the sorted runs already in it
+// Runs that go from big to small are kept as they are and strictly ascending ones are reversed, found in one pass
+// Then only the runs are merged, so a sorted list costs O(n). Returns the number of runs found, 0 without a compare function
+size_t natural_merge_sort_ll(linked_list *list);
+
+// Sorts the linked list by the unsigned keys key_p gives for the values, the biggest first like merge_sort_ll
+// Values with the same key keep their order. Each key is taken once and the nodes are relinked after one counting
+// pass per byte in which the keys differ, O(n) without calling a compare function
+void radix_sort_ll(linked_list *list, unsigned long long (*key_p)(const void *value));
+
+// Keys for radix_sort_ll that order int, long, float and double values like comparing them would, except that
+// -0.0 comes after 0.0 and NaN values are ordered by their bits
+unsigned long long int_key_ll(const void *value);
+
+unsigned long long long_key_ll(const void *value);
+
+unsigned long long float_key_ll(const void *value);
+
+unsigned long long double_key_ll(const void *value);
+
 // Checks if the linked list is sorted returns 1 if it is, compare function must be set
 int is_sorted_ll(linked_list *list);
 
 // Returns the index of a certain values occurence in the linked list, occurence >= 1, returns the size of the linked list if it there is no value at such occurrence
 size_t get_index_ll(linked_list *list, void *value, size_t occurrence);
 
+// Returns 1 if a value comparing equal to value is in the list else 0, needs a compare function
+int contains_ll(linked_list *list, void *value);
+
 // Copies the entire linked list into an array stored on the heap, need to free both
 // Each element of the array is a void * to data
 void **get_as_array_ll(linked_list *list);
 
+// Copies every value of the linked list back to back into one buffer stored on the heap, only the buffer has to be freed
+// A fixed size linked list gives size * elem_size bytes, packed_size (if not NULL) is set to the number of bytes
+void *get_packed_array_ll(linked_list *list, size_t *packed_size);
+
+// Array stored on the heap that points at the values inside the linked list, nothing is copied so only free the array
+// The pointers stay valid until their values are removed, the list is freed or relinked by defragment_ll, combine_ll or splice_ll
+void **view_as_array_ll(linked_list *list);
+
 // Converts the entire linked list into an array stored on the heap, linked list is freed, still need to free array
-// Each element of the array is a void * to data
+// Each element of the array is a void * to data. Values are moved out without copying like extract_ll does, except
+// co-allocated ones which are copied into their own malloc block. Free each element like an extracted value
 void **convert_to_array_ll(linked_list *list);
 
 // Assumes array is already stored on the heap, frees the array when converting to linked list
@@ -132,6 +374,20 @@ linked_list *array_to_linked_list(void **array, size_t size_of_array, size_t siz
 // Also converts array to linked list but the array is not freed
 linked_list *array_as_linked_list(void **array, size_t size_of_array, size_t size_of_value, void *(*allocator_p)(size_t), void (*freev)(void*));
 
+// The fixed versions of array_to_linked_list and array_as_linked_list make a linked list with an element size of
+// size_of_value, see new_fixed_linked_list. Values added to it later must have that size
+linked_list *array_to_fixed_linked_list(void **array, size_t size_of_array, size_t size_of_value, void *(*allocator_p)(size_t), void (*freev)(void *));
+
+linked_list *array_as_fixed_linked_list(void **array, size_t size_of_array, size_t size_of_value, void *(*allocator_p)(size_t), void (*freev)(void*));
+
+// Makes a fixed size arena linked list out of count values stored next to each other in buffer, see set_arena_ll
+// Every node comes from the same allocation, the buffer is not freed
+linked_list *buffer_to_linked_list(const void *buffer, size_t count, size_t elem_size, void *(*allocator_p)(size_t));
+
+// Converts array to linked list by taking ownership of the values instead of copying them, frees only the array
+// Values must be allocated like the ones given to append_adopt_ll
+linked_list *array_adopt_linked_list(void **array, size_t size_of_array, size_t size_of_value, void *(*allocator_p)(size_t), void (*freev)(void *));
+
 // Prints the function addresses and does a size check and a tail pointer check by iterating over
 // the linked list. Prints size and tail address as well.
 // Set fix to 1 if you want the function to attempt to fix the linked list else 0
@@ -143,10 +399,35 @@ int internal_check_ll(linked_list *list, int fix);
 // Set display_fix_message to 1 if you want to see what it did
 void fix_ll(linked_list *list, int display_fix_message);
 
+// Moves every node into new memory in list order so walking the list reads memory front to back, useful after
+// merge_sort_ll or a lot of inserting and deleting. The list keeps its storage mode: pooled and arena lists get one
+// new slab holding every node. Other lists only copy each node into a new allocation in list order, where the copies
+// land is up to the allocater so they get no such guarantee. Use set_pool_ll or set_arena_ll when locality matters
+// Co-allocated values move with their node, set include_values to 1 to also move values of a list that is not
+// co-allocated. Returns the bytes of slabs given back, always 0 for lists without a pool as the heap does not say
+// Handles, cursors and views of the list must not be used afterwards (caught when built with -DLL_DEBUG_HANDLES)
+// Does nothing if the list shares its pool
+size_t defragment_ll(linked_list *list, int include_values);
+
 // Links freed onto the end of combined by combined->tail->next = freed->head as well as freeing freed linked_list struct
 // Adds sizes together, keeps combined methods not freed methods. Sets tail to combined->tail = freed->tail;
+// If the lists store their nodes differently (co-allocated, pooled) the nodes of freed are moved into new nodes of combined
 void combine_ll(linked_list *combined, linked_list *freed);
 
+// Moves the start <= end indexed nodes of src into dst so the first of them ends up at dst_index (0 to the size of dst)
+// The nodes are relinked without copying when both lists store nodes the same way, else they are moved like in combine_ll
+// Returns the number of nodes moved, 0 if an index is out of range or dst and src are the same list
+size_t splice_ll(linked_list *dst, size_t dst_index, linked_list *src, size_t start, size_t end);
+
+// Splits the linked list in two, the nodes from index on are relinked into the returned linked list without copying
+// The returned list shares the storage of list like seperate_linked_list does. Returns NULL if index is greater than the size
+linked_list *split_at_ll(linked_list *list, size_t index);
+
+// Returns the memory the linked list uses, kept up to date as nodes are added, removed and moved so it does not walk the list
+// Heap overhead is estimated as one size_t per allocation rounded up to the alignment of malloc
+// Lists sharing a pool or string store each report all of its slabs
+ll_memory_stats get_memory_stats_ll(linked_list *list);
+
 // These are getter methods that returns a copy of the data type stated in the method name, not pointers
 // Note these methods do not check types they assume that there is actually the given type there
 // If you are unsure if you are getting the correct type do not use these methods below they will crash your program
@@ -171,4 +452,176 @@ char get_char_val_ll(linked_list *list, size_t index);
 unsigned char get_uchar_val_ll(linked_list *list, size_t index);
 
 char *get_str_val_ll(linked_list *list, size_t index);
+
+// Constructor for a linked list of strings, the characters are copied into an arena shared by the list and the
+// lists cloned, sliced, seperated or combined from it, values are char * pointing into it so get_str_val_ll does not copy
+// Set intern to 1 to store every distinct string once, equal strings are then the same pointer
+// Print and compare functions are set, compare orders by bytes and uses the stored lengths
+// Strings are only freed with the last list using them, so they stay valid after being deleted or extracted
+// Only add values with the _str_ll functions below, get_index_ll needs a value from the list, use get_index_str_ll
+linked_list *new_string_linked_list(int intern, void *(*allocator_p)(size_t));
+
+size_t append_str_ll(linked_list *list, const char *str);
+
+void prepend_str_ll(linked_list *list, const char *str);
+
+int insert_str_ll(linked_list *list, const char *str, size_t index);
+
+// Returns the stored length of the string at index without scanning it
+size_t get_str_len_ll(linked_list *list, size_t index);
+
+// Same as get_index_ll for a string, when interning a string that was never stored returns the size right away
+size_t get_index_str_ll(linked_list *list, const char *str, size_t occurrence);
+
+/*
+
+UNROLLED LIST:
+
+An unrolled list stores its elements by value in blocks that each hold up to block_capacity elements of the
+same size, so scans and indexed access touch a cache miss per block instead of per element
+Functions mirror the linked list ones with _ul instead of _ll, elements are copied in and out with the
+deep copy function like the linked list does, data_size is not passed since every element has elem_size bytes
+Blocks are split when inserting into a full block and merged with the next block when they fall under half full
+
+The free function is NULL by default, set it only if elements point to memory that needs freeing, it must not
+free the element itself
+
+*/
+typedef struct unrolled_list unrolled_list;
+
+// Position of an iteration over an unrolled list, made by cursor_begin_ul and kept on the stack of the caller
+// Any number of cursors can be used at the same time as long as no one changes the list
+typedef struct ul_cursor {
+	unrolled_list *list;
+	void *block; // Block of the element cursor_next_ul returns next, NULL at the end
+	size_t offset;
+} ul_cursor;
+
+// Constructor for unrolled list, block_capacity can be 0 to fit around 256 bytes of elements per block
+// allocator_p can be NULL, defaults to malloc
+unrolled_list *new_unrolled_list(size_t elem_size, size_t block_capacity, void *(*allocator_p)(size_t));
+
+void set_free_ul(unrolled_list *list, void (*free_p)(void *));
+
+void set_print_ul(unrolled_list *list, void (*print_p)(void *));
+
+void set_deep_copy_ul(unrolled_list *list, void *(*deep_copy_p)(void * restrict destination, const void * restrict source, size_t size));
+
+void set_deallocater_ul(unrolled_list *list, void (*deallocate_p)(void *));
+
+void set_compare_ul(unrolled_list *list, int (*compare_p)(const void *a, const void *b));
+
+size_t get_size_ul(unrolled_list *list);
+
+int is_empty_ul(unrolled_list *list);
+
+void empty_ul(unrolled_list *list);
+
+void free_unrolled_list(unrolled_list *list);
+
+void prepend_ul(unrolled_list *list, void *data);
+
+// Returns the index the element was added at
+size_t append_ul(unrolled_list *list, void *data);
+
+// Inserts so the element ends up at index, index can be 0 to size. Returns 1 if inserted else 0
+int insert_ul(unrolled_list *list, void *data, size_t index);
+
+int delete_ul(unrolled_list *list, size_t index);
+
+// Returns a copy of the element that must be freed and removes it from the list
+void *extract_head_ul(unrolled_list *list);
+
+void *extract_ul(unrolled_list *list, size_t index);
+
+// Returns a pointer to the element inside its block, it is only valid until the list is changed
+// The list keeps an index of where each block starts so the block is found in O(log(blocks))
+void *get_data_ul(unrolled_list *list, size_t index);
+
+void print_ul(unrolled_list *list);
+
+void map_ul(unrolled_list *list, void (*func)(void *));
+
+// Same as iter_ll, pass in the unrolled list first then NULL to get each element until NULL is returned
+void *iter_ul(unrolled_list *new_unrolled_list);
+
+// Reentrant version of iter_ul, returns a cursor before the first element of the unrolled list
+ul_cursor cursor_begin_ul(unrolled_list *list);
+
+// Returns a pointer to the next element inside its block and moves the cursor past it, NULL at the end
+void *cursor_next_ul(ul_cursor *cursor);
+
+size_t get_index_ul(unrolled_list *list, void *value, size_t occurrence);
+
+int is_sorted_ul(unrolled_list *list);
+
+// Sorts in the same order as merge_sort_ll, compare function must be set O(n log(n))
+void merge_sort_ul(unrolled_list *list);
+
+void reverse_ul(unrolled_list *list);
+
+unrolled_list *slice_unrolled_list(unrolled_list *list, size_t start, size_t end, void *(*allocator_p)(size_t));
+
+// Links the blocks of freed onto combined and frees the freed struct like combine_ll. Elements of a list with another
+// block capacity are moved into new blocks. Lists with different element sizes can not be combined, freed is then
+// freed with its elements and combined is left as it was
+void combine_ul(unrolled_list *combined, unrolled_list *freed);
+
+/*
+
+COMPRESSED LIST:
+
+A compressed list only stores ints, for long lists of sorted or nearly sorted ids. Values are kept in blocks as the
+first value followed by the difference to the previous value, zigzag and varint encoded so small differences take
+a single byte. Values can only be appended, functions mirror the linked list ones with _cl instead of _ll
+
+*/
+typedef struct compressed_list compressed_list;
+
+// Position of an iteration over a compressed list, made by cursor_begin_cl and kept on the stack of the caller
+// It holds its own decoded value so any number of cursors can be used at the same time while no one appends
+typedef struct cl_cursor {
+	void *block; // Block of the value cursor_next_cl decodes next, NULL at the end
+	size_t offset; // Values of the block already decoded
+	size_t used; // Bytes of the block already decoded
+	int value;
+} cl_cursor;
+
+// Constructor for compressed list, block_bytes is how many bytes of differences a block holds, 0 defaults to 256
+// allocator_p can be NULL, defaults to malloc
+compressed_list *new_compressed_list(size_t block_bytes, void *(*allocator_p)(size_t));
+
+void set_deallocater_cl(compressed_list *list, void (*deallocate_p)(void *));
+
+size_t get_size_cl(compressed_list *list);
+
+void empty_cl(compressed_list *list);
+
+void free_compressed_list(compressed_list *list);
+
+// Returns the index the value was added at
+size_t append_cl(compressed_list *list, int value);
+
+// Decodes the value at index, returns 0 if index is not smaller than the size
+int get_int_val_cl(compressed_list *list, size_t index);
+
+// Same as iter_ll, the returned pointer is to a decoded copy that is overwritten by the next call
+void *iter_cl(compressed_list *new_compressed_list);
+
+// Reentrant version of iter_cl, returns a cursor before the first value of the compressed list
+cl_cursor cursor_begin_cl(compressed_list *list);
+
+// Decodes the next value into the cursor and returns a pointer to it, NULL at the end
+int *cursor_next_cl(cl_cursor *cursor);
+
+size_t get_index_cl(compressed_list *list, int value, size_t occurrence);
+
+// Decodes, sorts in the same order as merge_sort_ll with an int compare function and encodes again
+void merge_sort_cl(compressed_list *list);
+
+// Returns the bytes the compressed list uses, counting an estimated allocator header for the list and every block
+size_t get_memory_cl(compressed_list *list);
+
+// Returns how many times less memory the list uses than a linked list holding the same ints
+double get_compression_ratio_cl(compressed_list *list);
 #endif
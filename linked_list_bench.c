@@ -0,0 +1,441 @@
+#include "linked_list.h"
+#include <stdio.h>
+#include <time.h>
+#include <stdlib.h>
+
+size_t allocations = 0;
+long long sorted_total = 0;
+
+void add_to_total(void *value) {
+	sorted_total += *(int*)value;
+}
+
+void *counting_malloc(size_t size) {
+	allocations++;
+	return malloc(size);
+}
+
+int compare_int(const void *a, const void *b) {
+	int aa = *(int*)(a);
+	int bb = *(int*)(b);
+
+	if (aa > bb) {
+		return 1;
+	} else if (aa == bb) {
+		return 0;
+	} else {
+		return -1;
+	}
+}
+
+void print_memory_stats(const char *name, linked_list *list) {
+	ll_memory_stats stats = get_memory_stats_ll(list);
+	printf("Memory of the %s: %zu node bytes, %zu value bytes, %zu overhead bytes, %zu allocations, %zu deallocations\n",
+		name, stats.node_bytes, stats.value_bytes, stats.overhead_bytes, stats.allocations, stats.deallocations);
+}
+
+size_t hash_int(const void *value) {
+	return (size_t) *(const int*) value * 0x9E3779B97F4A7C15ULL;
+}
+
+// Timings of the storage modes, sorts and indexes on big lists, the checks of the same functions are in linked_list_test.c
+int main() {
+	clock_t start, end;
+	double cpu_time_used;
+	int i;
+	int temp;
+
+	linked_list *five_mil_test = new_linked_list(NULL);
+	start = clock();
+	for (i = 0; i < 5000000; i++) {
+		prepend_ll(five_mil_test, &i, sizeof(int));
+	}
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by the CPU to prepend 5 million elements to a empty linked_list!\n", cpu_time_used);
+
+	linked_list *fixed_list = new_fixed_linked_list(sizeof(int), NULL);
+	start = clock();
+	for (i = 0; i < 5000000; i++) {
+		prepend_ll(fixed_list, &i, sizeof(int));
+	}
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by the CPU to prepend 5 million elements to a empty fixed size linked_list!\n", cpu_time_used);
+	free_linked_list(fixed_list);
+
+	linked_list *co_allocated = new_linked_list(NULL);
+	set_co_allocate_ll(co_allocated, 1);
+	start = clock();
+	for (i = 0; i < 5000000; i++) {
+		prepend_ll(co_allocated, &i, sizeof(int));
+	}
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by the CPU to prepend 5 million elements to a empty co-allocated linked_list!\n", cpu_time_used);
+	free_linked_list(co_allocated);
+
+	linked_list *pooled = new_linked_list(counting_malloc);
+	set_pool_ll(pooled, sizeof(int), 1024);
+	for (i = 0; i < 1000; i++) {
+		append_ll(pooled, &i, sizeof(int));
+	}
+	allocations = 0;
+	start = clock();
+	for (i = 0; i < 5000000; i++) {
+		append_ll(pooled, &i, sizeof(int));
+		extract_head_into_ll(pooled, &temp);
+	}
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by the CPU to append and extract 5 million elements through a pooled linked_list, %zu allocations!\n", cpu_time_used, allocations);
+	free_linked_list(pooled);
+
+	linked_list *arena_list = new_linked_list(NULL);
+	set_arena_ll(arena_list, 1 << 20);
+	for (i = 0; i < 5000000; i++) {
+		prepend_ll(arena_list, &i, sizeof(int));
+	}
+	start = clock();
+	free_linked_list(arena_list);
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by the CPU to free a 5 million element arena linked_list!\n", cpu_time_used);
+	start = clock();
+	free_linked_list(five_mil_test);
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by the CPU to free a 5 million element linked_list!\n", cpu_time_used);
+
+	linked_list *list_to_sort = new_linked_list(NULL);
+	set_compare_ll(list_to_sort, compare_int);
+	srand(time(NULL));
+	for (i = 0; i < 5000000; i++) {
+		temp = rand() % 5000000;
+		prepend_ll(list_to_sort, &temp, sizeof(int));
+	}
+	linked_list *parallel_sorted = clone_linked_list(list_to_sort, NULL);
+	linked_list *radix_sorted = clone_linked_list(list_to_sort, NULL);
+	linked_list *in_place_sorted = clone_linked_list(list_to_sort, NULL);
+	start = clock();
+	merge_sort_ll(list_to_sort);
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to sort a 5 million random elements linked list (merge sort)!\n", cpu_time_used);
+
+	struct timespec wall_start, wall_end;
+	timespec_get(&wall_start, TIME_UTC);
+	parallel_merge_sort_ll(parallel_sorted, 0);
+	timespec_get(&wall_end, TIME_UTC);
+	printf("%f Seconds of wall time to sort the same 5 million elements with parallel_merge_sort_ll!\n",
+		(wall_end.tv_sec - wall_start.tv_sec) + (wall_end.tv_nsec - wall_start.tv_nsec) / 1e9);
+	free_linked_list(parallel_sorted);
+	start = clock();
+	radix_sort_ll(radix_sorted, int_key_ll);
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to sort the same 5 million elements with radix_sort_ll!\n", cpu_time_used);
+	free_linked_list(radix_sorted);
+	start = clock();
+	merge_sort_in_place_ll(in_place_sorted);
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to sort the same 5 million elements with merge_sort_in_place_ll!\n", cpu_time_used);
+	free_linked_list(in_place_sorted);
+	start = clock();
+	size_t runs_found = natural_merge_sort_ll(list_to_sort);
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to natural merge sort the already sorted 5 million elements (%zu run)\n", cpu_time_used, runs_found);
+	linked_list *glued = new_linked_list(NULL);
+	linked_list *glued_end = new_linked_list(NULL);
+	set_compare_ll(glued, compare_int);
+	for (i = 0; i < 1000000; i++) {
+		append_ll(glued, &i, sizeof(int));
+		temp = 2 * i;
+		prepend_ll(glued_end, &temp, sizeof(int));
+	}
+	combine_ll(glued, glued_end);
+	start = clock();
+	runs_found = natural_merge_sort_ll(glued);
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to natural merge sort two glued 1 million elements lists (%zu runs)\n", cpu_time_used, runs_found);
+	free_linked_list(glued);
+
+	sorted_total = 0;
+	start = clock();
+	map_ll(list_to_sort, add_to_total);
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to map over the sorted 5 million elements linked list (total %lld)!\n", cpu_time_used, sorted_total);
+	print_memory_stats("sorted heap list", list_to_sort);
+	defragment_ll(list_to_sort, 1);
+	print_memory_stats("defragmented list", list_to_sort);
+	sorted_total = 0;
+	start = clock();
+	map_ll(list_to_sort, add_to_total);
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to map over the defragmented 5 million elements linked list (total %lld)!\n", cpu_time_used, sorted_total);
+	free_linked_list(list_to_sort);
+
+	linked_list *stepped = new_linked_list(NULL);
+	set_compare_ll(stepped, compare_int);
+	for (i = 0; i < 1000000; i++) {
+		temp = rand() % 1000000;
+		append_ll(stepped, &temp, sizeof(int));
+	}
+	ll_sort *step_sort = sort_begin_ll(stepped);
+	size_t steps = 0;
+	double longest_step = 0;
+	int step_done = 0;
+	while (!step_done) {
+		start = clock();
+		step_done = sort_step_ll(step_sort, 100000);
+		end = clock();
+		cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+		longest_step = (cpu_time_used > longest_step) ? cpu_time_used : longest_step;
+		steps++;
+	}
+	sort_finish_ll(step_sort);
+	printf("Sorted a 1 million random elements linked list in %zu steps of 100000 comparisons, longest step %f Seconds!\n", steps, longest_step);
+	free_linked_list(stepped);
+
+	linked_list *indexed = new_linked_list(NULL);
+	for (i = 0; i < 1000000; i++) {
+		append_ll(indexed, &i, sizeof(int));
+	}
+	long long indexed_total = 0;
+	start = clock();
+	for (i = 0; i < 200; i++) {
+		indexed_total += get_int_val_ll(indexed, ((size_t) i * 7919) % 1000000);
+	}
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU for 200 random gets on a 1 million elements linked list (total %lld)\n", cpu_time_used, indexed_total);
+	set_skip_index_ll(indexed, 1);
+	indexed_total = 0;
+	start = clock();
+	for (i = 0; i < 200; i++) {
+		indexed_total += get_int_val_ll(indexed, ((size_t) i * 7919) % 1000000);
+	}
+	for (i = 0; i < 100000; i++) {
+		temp = -i;
+		insert_ll(indexed, &temp, sizeof(int), ((size_t) i * 7919) % 1000000);
+		delete_ll(indexed, ((size_t) i * 104729) % 1000000);
+	}
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU with a skip index for the same gets (total %lld) and 100000 random inserts and deletes\n", cpu_time_used, indexed_total);
+	indexed_total = 0;
+	start = clock();
+	for (i = 0; i < (int) get_size_ll(indexed); i++) {
+		indexed_total += get_int_val_ll(indexed, i);
+	}
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to get every index of the 1 million elements linked list in order (total %lld)\n", cpu_time_used, indexed_total);
+
+	set_compare_ll(indexed, compare_int);
+	size_t found = 0;
+	start = clock();
+	for (i = 0; i < 20; i++) {
+		temp = i * 9973;
+		found += contains_ll(indexed, &temp);
+	}
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU for 20 contains_ll on the 1 million elements linked list (%zu found)\n", cpu_time_used, found);
+	set_hash_index_ll(indexed, hash_int);
+	found = 0;
+	start = clock();
+	for (i = 0; i < 100000; i++) {
+		temp = i * 9973;
+		found += contains_ll(indexed, &temp);
+	}
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to build a hash index and do 100000 contains_ll (%zu found)\n", cpu_time_used, found);
+	free_linked_list(indexed);
+
+	linked_list *edited = new_linked_list(NULL);
+	for (i = 0; i < 1000000; i++) {
+		append_ll(edited, &i, sizeof(int));
+	}
+	start = clock();
+	for (ll_handle handle = head_handle_ll(edited); handle.target != NULL; handle = next_handle_ll(edited, handle)) {
+		if (*(int*) get_handle_data_ll(handle) % 2 == 0) {
+			erase_after_ll(edited, handle);
+			temp = -*(int*) get_handle_data_ll(handle);
+			handle = insert_after_ll(edited, handle, &temp, sizeof(int));
+		}
+	}
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to replace every odd value after an even one with handles in a 1 million elements linked list\n", cpu_time_used);
+	free_linked_list(edited);
+
+	linked_list *deque = new_linked_list(NULL);
+	set_deque_ll(deque, 1);
+	set_co_allocate_ll(deque, 1);
+	for (i = 0; i < 1000000; i++) {
+		append_ll(deque, &i, sizeof(int));
+	}
+	start = clock();
+	reverse_ll(deque);
+	reverse_ll(deque);
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to reverse a 1 million elements deque linked list twice\n", cpu_time_used);
+	start = clock();
+	while (get_size_ll(deque) > 1) {
+		free(extract_tail_ll(deque));
+	}
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to pop all but one element from the back of the deque\n", cpu_time_used);
+	free_linked_list(deque);
+
+	linked_list *batch = new_linked_list(NULL);
+	for (i = 0; i < 1000000; i++) {
+		append_ll(batch, &i, sizeof(int));
+	}
+	size_t *batch_indexes = malloc(100000 * sizeof(size_t));
+	for (i = 0; i < 100000; i++) {
+		batch_indexes[i] = ((size_t) i * 7919) % 1000000;
+	}
+	start = clock();
+	size_t batch_deleted = delete_many_ll(batch, batch_indexes, 100000);
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to delete %zu unsorted indexes from a 1 million elements linked list in one pass\n", cpu_time_used, batch_deleted);
+	free(batch_indexes);
+	free_linked_list(batch);
+
+	int *buffer = malloc(1000000 * sizeof(int));
+	for (i = 0; i < 1000000; i++) {
+		buffer[i] = i;
+	}
+	start = clock();
+	linked_list *from_buffer = buffer_to_linked_list(buffer, 1000000, sizeof(int), NULL);
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to make a 1 million elements linked list out of a buffer\n", cpu_time_used);
+	start = clock();
+	prepend_many_ll(from_buffer, buffer, 1000, sizeof(int));
+	append_many_ll(from_buffer, buffer + 1000, 1000, sizeof(int));
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to prepend and append 1000 elements batches\n", cpu_time_used);
+	print_memory_stats("buffer linked list", from_buffer);
+	start = clock();
+	void **copied_values = get_as_array_ll(from_buffer);
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to copy a 1 million elements linked list into an array of pointers\n", cpu_time_used);
+	for (i = 0; i < (int) get_size_ll(from_buffer); i++) {
+		free(copied_values[i]);
+	}
+	free(copied_values);
+	size_t packed_size;
+	start = clock();
+	int *packed = get_packed_array_ll(from_buffer, &packed_size);
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to pack a 1 million elements linked list into one buffer (%zu bytes)\n", cpu_time_used, packed_size);
+	start = clock();
+	void **viewed = view_as_array_ll(from_buffer);
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to view a 1 million elements linked list as an array\n", cpu_time_used);
+	free(packed);
+	free(viewed);
+	free_linked_list(from_buffer);
+	free(buffer);
+
+	linked_list *splice_src = new_linked_list(NULL);
+	linked_list *splice_dst = new_linked_list(NULL);
+	for (i = 0; i < 1000000; i++) {
+		append_ll(splice_src, &i, sizeof(int));
+	}
+	start = clock();
+	size_t spliced = splice_ll(splice_dst, 0, splice_src, 250000, 749999);
+	linked_list *split = split_at_ll(splice_src, 125000);
+	combine_ll(splice_dst, split);
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to splice %zu elements, split and combine\n", cpu_time_used, spliced);
+	free_linked_list(splice_src);
+	free_linked_list(splice_dst);
+
+	linked_list *cursored = new_linked_list(NULL);
+	for (i = 0; i < 1000000; i++) {
+		append_ll(cursored, &i, sizeof(int));
+	}
+	start = clock();
+	ll_cursor cursor = cursor_begin_ll(cursored);
+	int *cursor_val;
+	while ((cursor_val = cursor_next_ll(&cursor)) != NULL) {
+		if (*cursor_val % 2) {
+			cursor_remove_ll(&cursor);
+		}
+	}
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to remove every odd value with a cursor (size %zu)\n", cpu_time_used, get_size_ll(cursored));
+	free_linked_list(cursored);
+
+	unrolled_list *unrolled = new_unrolled_list(sizeof(int), 0, NULL);
+	set_compare_ul(unrolled, compare_int);
+	for (i = 0; i < 5000000; i++) {
+		temp = rand() % 5000000;
+		append_ul(unrolled, &temp);
+	}
+	long long unrolled_total = 0;
+	start = clock();
+	for (i = 0; i < 5000000; i += 1000) {
+		unrolled_total += *(int*) get_data_ul(unrolled, i);
+	}
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by the CPU for 5000 indexed reads on a 5 million element unrolled list (total %lld)!\n", cpu_time_used, unrolled_total);
+	start = clock();
+	merge_sort_ul(unrolled);
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to sort a 5 million random elements unrolled list (merge sort)!\n", cpu_time_used);
+	free_unrolled_list(unrolled);
+
+	compressed_list *ids = new_compressed_list(0, NULL);
+	for (i = 0; i < 5000000; i++) {
+		append_cl(ids, i * 3 + (i % 7));
+	}
+	printf("Compressed list of 5 million ids uses %zu bytes, compression ratio %f\n", get_memory_cl(ids), get_compression_ratio_cl(ids));
+	start = clock();
+	merge_sort_cl(ids);
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to sort a 5 million ids compressed list\n", cpu_time_used);
+	free_compressed_list(ids);
+
+	const char *tokens[] = {"GET", "POST", "GET", "/index.html", "200", "GET", "404", "/index.html", "PUT", "200"};
+	char token[32];
+	linked_list *token_list = new_string_linked_list(1, NULL);
+	start = clock();
+	for (i = 0; i < 1000000; i++) {
+		if (i % 100 == 0) {
+			sprintf(token, "session-%d", i % 5000);
+			append_str_ll(token_list, token);
+		} else {
+			append_str_ll(token_list, tokens[i % 10]);
+		}
+	}
+	merge_sort_ll(token_list);
+	end = clock();
+	cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+	printf("%f Seconds used by CPU to intern and sort 1 million log tokens!\n", cpu_time_used);
+	print_memory_stats("interned token list", token_list);
+	free_linked_list(token_list);
+	return 0;
+}
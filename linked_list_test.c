@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include <time.h>
 #include <stdlib.h>
+#include <string.h>
 
 void print_as_int(void *value) {
 	printf("Integer: %d\n", *(int*)value);
@@ -15,6 +16,18 @@ int remove_odd_values(void *data) {
 	return (*(int *)data) % 2;
 }
 
+size_t allocations = 0;
+long long sorted_total = 0;
+
+void add_to_total(void *value) {
+	sorted_total += *(int*)value;
+}
+
+void *counting_malloc(size_t size) {
+	allocations++;
+	return malloc(size);
+}
+
 int compare_int(const void *a, const void *b) {
 	int aa = *(int*)(a);
 	int bb = *(int*)(b);
@@ -29,6 +42,33 @@ int compare_int(const void *a, const void *b) {
 }
 
 
+size_t hash_int(const void *value) {
+	return (size_t) *(const int*) value * 0x9E3779B97F4A7C15ULL;
+}
+
+int failed_checks = 0;
+
+void check(int passed, const char *description) {
+	printf("%s: %s\n", passed ? "Passed" : "FAILED", description);
+	failed_checks += !passed;
+}
+
+// 1 when both lists hold the same ints in the same order
+int same_ints(linked_list *a, linked_list *b) {
+	if (get_size_ll(a) != get_size_ll(b)) {
+		return 0;
+	}
+	ll_cursor a_cursor = cursor_begin_ll(a);
+	ll_cursor b_cursor = cursor_begin_ll(b);
+	int *a_val;
+	while ((a_val = cursor_next_ll(&a_cursor)) != NULL) {
+		if (*a_val != *(int*) cursor_next_ll(&b_cursor)) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
 int main() {
 	int values[] = {1, 2, 3, 4, 5, 6, 7, 8};
 	linked_list *my_list = new_linked_list(NULL);
@@ -152,7 +192,33 @@ int main() {
 		free(my_array2[i]);
 	}
 
+	void **adopted_array = malloc(4 * sizeof(void *));
+	for (i = 0; i < 4; i++) {
+		adopted_array[i] = malloc(sizeof(int));
+		*(int*) adopted_array[i] = i * 10;
+	}
+	linked_list *adopted_list = array_adopt_linked_list(adopted_array, 4, sizeof(int), NULL, NULL);
+	int *adopted_value = malloc(sizeof(int));
+	*adopted_value = -1;
+	prepend_adopt_ll(adopted_list, adopted_value, sizeof(int));
+	adopted_value = malloc(sizeof(int));
+	*adopted_value = 15;
+	insert_adopt_ll(adopted_list, adopted_value, sizeof(int), 3);
+	adopted_value = malloc(sizeof(int));
+	*adopted_value = 99;
+	append_adopt_ll(adopted_list, adopted_value, sizeof(int));
+	int adopted_expected[] = {-1, 0, 10, 15, 20, 30, 99};
+	int adopted_matches = get_size_ll(adopted_list) == 7;
+	for (i = 0; adopted_matches && i < 7; i++) {
+		adopted_matches = get_int_val_ll(adopted_list, i) == adopted_expected[i];
+	}
+	check(adopted_matches, "adopted list is -1 0 10 15 20 30 99");
+	check(get_memory_stats_ll(adopted_list).allocations == 7, "adopted list allocated only its 7 nodes");
+	internal_check_ll(adopted_list, 0);
+	free_linked_list(adopted_list);
+
 	clock_t start, end;
+	int temp;
 	linked_list* five_mil_test = new_linked_list(NULL);
 
 	start = clock();
@@ -162,6 +228,93 @@ int main() {
 	end = clock();
 	double cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
 	printf("%f Seconds used by the CPU to prepend 5 million elements to a empty linked_list!\n", cpu_time_used);
+
+	linked_list *fixed_list = new_fixed_linked_list(sizeof(int), NULL);
+	for (i = 0; i < 1000; i++) {
+		prepend_ll(fixed_list, &i, sizeof(int));
+	}
+	check(get_int_val_ll(fixed_list, 0) == 999 && get_int_val_ll(fixed_list, 999) == 0, "fixed size list prepends");
+	empty_ll(fixed_list);
+	set_pool_ll(fixed_list, sizeof(int), 64);
+	for (i = 0; i < 8; i++) {
+		append_ll(fixed_list, &values[i], 0);
+	}
+	insert_ll(fixed_list, &values[7], 0, 2);
+	linked_list *fixed_clone = clone_linked_list(fixed_list, NULL);
+	void **fixed_array = get_as_array_ll(fixed_clone);
+	linked_list *fixed_from_array = array_to_fixed_linked_list(fixed_array, get_size_ll(fixed_clone), sizeof(int), NULL, NULL);
+	combine_ll(fixed_from_array, fixed_clone);
+	check(get_int_val_ll(fixed_from_array, 2) == 8 && get_int_val_ll(fixed_from_array, 11) == 8 && get_size_ll(fixed_from_array) == 18,
+		"fixed size list from an array combined with a pooled clone");
+	internal_check_ll(fixed_from_array, 0);
+	free_linked_list(fixed_from_array);
+	free_linked_list(fixed_list);
+
+	linked_list *co_allocated = new_linked_list(NULL);
+	set_co_allocate_ll(co_allocated, 1);
+	set_print_ll(co_allocated, print_as_int);
+	for (i = 0; i < 1000; i++) {
+		prepend_ll(co_allocated, &i, sizeof(int));
+	}
+	check(set_co_allocate_ll(co_allocated, 0) == 0, "co-allocate mode does not change on a non empty list");
+	empty_ll(co_allocated);
+	for (i = 0; i < 8; i++) {
+		append_ll(co_allocated, &values[i], sizeof(int));
+	}
+	insert_ll(co_allocated, &values[0], sizeof(int), 3);
+	delete_ll(co_allocated, 0);
+	void *co_extract = extract_ll(co_allocated, 4);
+	check(*(int*)co_extract == 5, "extract from co-allocated index 4");
+	free(co_extract);
+	filter_ll(co_allocated, remove_odd_values);
+	linked_list *co_clone = clone_linked_list(co_allocated, NULL);
+	printf("----- Co-allocated list after insert, delete, extract and filtering odd values (cloned) -----\n");
+	print_ll(co_clone);
+	internal_check_ll(co_clone, 0);
+	free_linked_list(co_clone);
+	free_linked_list(co_allocated);
+
+	linked_list *pooled = new_linked_list(counting_malloc);
+	set_pool_ll(pooled, sizeof(int), 1024);
+	for (i = 0; i < 1000; i++) {
+		append_ll(pooled, &i, sizeof(int));
+	}
+	allocations = 0;
+	for (i = 0; i < 100000; i++) {
+		append_ll(pooled, &i, sizeof(int));
+		extract_head_into_ll(pooled, &temp);
+	}
+	check(allocations == 0, "pooled list recycles its slots instead of allocating");
+	linked_list *pooled_odds = seperate_linked_list(pooled, remove_odd_values, NULL);
+	filter_ll(pooled, remove_all_ll);
+	linked_list *heap_list = new_linked_list(NULL);
+	append_ll(heap_list, &values[7], sizeof(int));
+	combine_ll(heap_list, slice_linked_list(pooled_odds, 0, 2, NULL));
+	combine_ll(pooled_odds, heap_list);
+	delete_ll(pooled_odds, 0);
+	size_t pooled_size = get_size_ll(pooled_odds);
+	check(get_int_val_ll(pooled_odds, pooled_size - 4) == 8 && get_int_val_ll(pooled_odds, pooled_size - 3) == 99001
+		&& get_int_val_ll(pooled_odds, pooled_size - 2) == 99003 && get_int_val_ll(pooled_odds, pooled_size - 1) == 99005,
+		"pooled odd values seperated and combined with a heap list end in 8 99001 99003 99005");
+	internal_check_ll(pooled_odds, 0);
+	linked_list *own_pool = clone_linked_list(pooled_odds, malloc);
+	free_linked_list(pooled_odds);
+	free_linked_list(pooled);
+	delete_ll(own_pool, 0);
+	append_ll(own_pool, &values[7], sizeof(int));
+	check(*(int*) get_data_ll(own_pool, get_size_ll(own_pool) - 1) == 8, "clone with its own pool outlives the shared pool");
+	internal_check_ll(own_pool, 0);
+	free_linked_list(own_pool);
+
+	linked_list *arena_list = new_linked_list(NULL);
+	set_arena_ll(arena_list, 1 << 20);
+	for (i = 0; i < 100000; i++) {
+		prepend_ll(arena_list, &i, sizeof(int));
+	}
+	delete_ll(arena_list, 10);
+	check(get_int_val_ll(arena_list, 10) == 99988, "arena list index 10 after deleting the old index 10");
+	internal_check_ll(arena_list, 0);
+	free_linked_list(arena_list);
 	
 	int ints[22] = {8, 2, 6, 2, 5, 9, 0, -3, -4, 2, 7, 8, 8, 2, 4, 3, 5, 6, 18, 2, 14, 6};
 	
@@ -190,7 +343,6 @@ int main() {
 	set_compare_ll(list_to_sort, compare_int);
 	set_print_ll(list_to_sort, print_as_int);
 	srand(time(NULL));
-	int temp;
 	for (i = 0; i < 5000000; i++) {
 		temp = rand() % 5000000;
 		prepend_ll(list_to_sort, &temp, sizeof(int));
@@ -203,6 +355,441 @@ int main() {
 	printf("%f Seconds used by CPU to sort a 5 million random elements linked list (merge sort)!\n", cpu_time_used);
 	internal_check_ll(list_to_sort, 0);
 
+	linked_list *small_sort = new_linked_list(NULL);
+	set_compare_ll(small_sort, compare_int);
+	for (i = 0; i < 10000; i++) {
+		temp = (i * 7919) % 5000;
+		append_ll(small_sort, &temp, sizeof(int));
+	}
+	linked_list *parallel_sorted = clone_linked_list(small_sort, NULL);
+	linked_list *radix_sorted = clone_linked_list(small_sort, NULL);
+	linked_list *in_place_sorted = clone_linked_list(small_sort, NULL);
+	linked_list *natural_sorted = clone_linked_list(small_sort, NULL);
+	merge_sort_ll(small_sort);
+	set_compare_ll(parallel_sorted, compare_int);
+	parallel_merge_sort_ll(parallel_sorted, 4);
+	check(same_ints(parallel_sorted, small_sort), "parallel_merge_sort_ll matches merge_sort_ll");
+	internal_check_ll(parallel_sorted, 0);
+	free_linked_list(parallel_sorted);
+	radix_sort_ll(radix_sorted, int_key_ll);
+	check(same_ints(radix_sorted, small_sort), "radix_sort_ll matches merge_sort_ll");
+	internal_check_ll(radix_sorted, 0);
+	free_linked_list(radix_sorted);
+	set_compare_ll(in_place_sorted, compare_int);
+	merge_sort_in_place_ll(in_place_sorted);
+	check(same_ints(in_place_sorted, small_sort), "merge_sort_in_place_ll matches merge_sort_ll");
+	internal_check_ll(in_place_sorted, 0);
+	free_linked_list(in_place_sorted);
+	set_compare_ll(natural_sorted, compare_int);
+	natural_merge_sort_ll(natural_sorted);
+	check(same_ints(natural_sorted, small_sort), "natural_merge_sort_ll matches merge_sort_ll");
+	free_linked_list(natural_sorted);
+	check(natural_merge_sort_ll(small_sort) == 1, "natural_merge_sort_ll finds one run in a sorted list");
+	free_linked_list(small_sort);
+	linked_list *glued = new_linked_list(NULL);
+	linked_list *glued_end = new_linked_list(NULL);
+	set_compare_ll(glued, compare_int);
+	for (i = 0; i < 1000; i++) {
+		append_ll(glued, &i, sizeof(int));
+		temp = 2 * i;
+		prepend_ll(glued_end, &temp, sizeof(int)); // Descending, so the sort reverses it
+	}
+	combine_ll(glued, glued_end);
+	check(natural_merge_sort_ll(glued) == 2 && is_sorted_ll(glued), "natural_merge_sort_ll sorts two glued runs");
+	internal_check_ll(glued, 0);
+	free_linked_list(glued);
+
+	linked_list *stepped = new_linked_list(NULL);
+	set_compare_ll(stepped, compare_int);
+	for (i = 0; i < 10000; i++) {
+		temp = (i * 104729) % 10000;
+		append_ll(stepped, &temp, sizeof(int));
+	}
+	ll_sort *step_sort = sort_begin_ll(stepped);
+	size_t steps = 0;
+	while (!sort_step_ll(step_sort, 1000)) {
+		if (++steps == 5) {
+			internal_check_ll(stepped, 0); // Still a valid list partway through
+		}
+	}
+	sort_finish_ll(step_sort);
+	check(steps > 5 && is_sorted_ll(stepped) && get_size_ll(stepped) == 10000, "sort_step_ll sorts in steps of 1000 comparisons");
+	free_linked_list(stepped);
+
+	linked_list *defragmented = new_linked_list(NULL);
+	set_compare_ll(defragmented, compare_int);
+	for (i = 0; i < 10000; i++) {
+		temp = (i * 7919) % 5000;
+		prepend_ll(defragmented, &temp, sizeof(int));
+	}
+	merge_sort_ll(defragmented);
+	sorted_total = 0;
+	map_ll(defragmented, add_to_total);
+	long long before_defragment = sorted_total;
+	check(defragment_ll(defragmented, 1) == 0, "defragmenting a heap list reclaims no slab bytes");
+	sorted_total = 0;
+	map_ll(defragmented, add_to_total);
+	check(sorted_total == before_defragment && is_sorted_ll(defragmented), "defragmented list keeps its values and order");
+	delete_ll(defragmented, 0);
+	internal_check_ll(defragmented, 0);
+	free_linked_list(defragmented);
+	linked_list *pooled_gaps = new_linked_list(NULL);
+	set_pool_ll(pooled_gaps, sizeof(int), 64);
+	for (i = 0; i < 6400; i++) {
+		append_ll(pooled_gaps, &i, sizeof(int));
+	}
+	filter_ll(pooled_gaps, remove_odd_values);
+	check(defragment_ll(pooled_gaps, 0) > 0, "defragmenting a half empty pooled list gives back slabs");
+	check(get_int_val_ll(pooled_gaps, 1) == 2 && get_size_ll(pooled_gaps) == 3200, "defragmented pooled list keeps its values");
+	internal_check_ll(pooled_gaps, 0);
+	free_linked_list(pooled_gaps);
+
+	linked_list *stats_list = new_linked_list(NULL);
+	for (i = 0; i < 100; i++) {
+		append_ll(stats_list, &i, sizeof(int));
+	}
+	linked_list *stats_clone = clone_linked_list(stats_list, NULL);
+	delete_ll(stats_clone, 0);
+	free(extract_ll(stats_clone, 0));
+	combine_ll(stats_list, stats_clone);
+	ll_memory_stats stats = get_memory_stats_ll(stats_list);
+	check(stats.node_bytes == 198 * sizeof(void *) * 3 && stats.value_bytes == 198 * sizeof(int),
+		"memory stats after clone, delete, extract and combine");
+	free_linked_list(stats_list);
+
+	linked_list *indexed = new_linked_list(NULL);
+	linked_list *unindexed = new_linked_list(NULL);
+	for (i = 0; i < 10000; i++) {
+		append_ll(indexed, &i, sizeof(int));
+		append_ll(unindexed, &i, sizeof(int));
+	}
+	set_skip_index_ll(indexed, 1);
+	for (i = 0; i < 1000; i++) {
+		temp = -i;
+		insert_ll(indexed, &temp, sizeof(int), ((size_t) i * 7919) % 10000);
+		insert_ll(unindexed, &temp, sizeof(int), ((size_t) i * 7919) % 10000);
+		delete_ll(indexed, ((size_t) i * 104729) % 10000);
+		delete_ll(unindexed, ((size_t) i * 104729) % 10000);
+	}
+	check(same_ints(indexed, unindexed), "skip index list matches a plain list after 1000 inserts and deletes");
+	int indexed_matches = 1;
+	for (i = 0; indexed_matches && i < 10000; i += 37) {
+		indexed_matches = get_int_val_ll(indexed, i) == get_int_val_ll(unindexed, i);
+	}
+	check(indexed_matches, "skip index gets match a plain list");
+	temp = get_int_val_ll(indexed, 0);
+	reverse_ll(indexed);
+	check(get_int_val_ll(indexed, 9999) == temp, "reversed indexed list holds the old head at its tail");
+	internal_check_ll(indexed, 0);
+	set_compare_ll(indexed, compare_int);
+	set_compare_ll(unindexed, compare_int);
+	merge_sort_ll(indexed);
+	merge_sort_ll(unindexed);
+	indexed_matches = 1;
+	for (i = 0; indexed_matches && i < 10000; i += 37) {
+		indexed_matches = get_int_val_ll(indexed, i) == get_int_val_ll(unindexed, i);
+	}
+	check(indexed_matches, "skip index gets match a plain list after sorting");
+	free_linked_list(unindexed);
+
+	ll_cursor in_order = cursor_begin_ll(indexed);
+	int in_order_matches = 1;
+	for (i = 0; in_order_matches && i < (int) get_size_ll(indexed); i++) {
+		in_order_matches = get_int_val_ll(indexed, i) == *(int*) cursor_next_ll(&in_order);
+	}
+	check(in_order_matches, "gets in index order match a cursor walk");
+
+	set_hash_index_ll(indexed, hash_int);
+	int lookups_agree = 1;
+	for (i = 0; lookups_agree && i < 1000; i++) {
+		lookups_agree = contains_ll(indexed, &i) == (get_index_ll(indexed, &i, 1) < get_size_ll(indexed));
+	}
+	check(lookups_agree, "contains_ll with a hash index agrees with get_index_ll");
+	temp = -7;
+	prepend_ll(indexed, &temp, sizeof(int));
+	temp = get_int_val_ll(indexed, 5000);
+	size_t found_at = get_index_ll(indexed, &temp, 1);
+	check(get_index_ll(indexed, &(int){-7}, 1) == 0, "hash index finds a prepended value at 0");
+	check(found_at <= 5000 && get_int_val_ll(indexed, found_at) == temp, "hash index finds a value where the list holds it");
+	insert_ll(indexed, &temp, sizeof(int), 1);
+	check(get_index_ll(indexed, &temp, 1) == 1 && get_index_ll(indexed, &temp, 2) == found_at + 1,
+		"hash index finds both occurrences after inserting in the middle");
+	filter_ll(indexed, remove_odd_values);
+	int filtered_agree = 1;
+	for (i = 0; filtered_agree && i < 1000; i++) {
+		found_at = get_index_ll(indexed, &i, 1);
+		filtered_agree = contains_ll(indexed, &i) == (found_at < get_size_ll(indexed)) && (found_at == get_size_ll(indexed)
+			|| (i % 2 == 0 && get_int_val_ll(indexed, found_at) == i));
+	}
+	check(filtered_agree, "hash index lookups after filter_ll");
+	free_linked_list(indexed);
+
+	linked_list *edited = new_linked_list(NULL);
+	for (i = 0; i < 10000; i++) {
+		append_ll(edited, &i, sizeof(int));
+	}
+	for (ll_handle handle = head_handle_ll(edited); handle.target != NULL; handle = next_handle_ll(edited, handle)) {
+		if (*(int*) get_handle_data_ll(handle) % 2 == 0) {
+			erase_after_ll(edited, handle); // Drops the odd value after it
+			temp = -*(int*) get_handle_data_ll(handle);
+			handle = insert_after_ll(edited, handle, &temp, sizeof(int));
+		}
+	}
+	check(get_size_ll(edited) == 10000 && get_int_val_ll(edited, 2) == 2 && get_int_val_ll(edited, 3) == -2,
+		"handles replace every odd value after an even one");
+	internal_check_ll(edited, 0);
+	free_linked_list(edited);
+
+	linked_list *skip_edited = new_linked_list(NULL);
+	set_skip_index_ll(skip_edited, 1);
+	for (i = 0; i < 10000; i++) {
+		append_ll(skip_edited, &i, sizeof(int));
+	}
+	ll_handle chain = insert_handle_ll(skip_edited, &(int){-1}, sizeof(int), 5000);
+	int chain_sum = 0;
+	for (i = 0; i < 1000; i++) {
+		chain = insert_after_ll(skip_edited, chain, &i, sizeof(int));
+		erase_after_ll(skip_edited, chain); // Drops the value that was at 5000 + i
+		chain_sum += get_int_val_ll(skip_edited, 9000);
+	}
+	check(get_int_val_ll(skip_edited, 6000) == 999 && get_int_val_ll(skip_edited, 6001) == 6000 && chain_sum == 8999000,
+		"handle edits keep the skip index");
+	internal_check_ll(skip_edited, 0);
+	free_linked_list(skip_edited);
+
+	linked_list *deque = new_linked_list(NULL);
+	set_deque_ll(deque, 1);
+	set_co_allocate_ll(deque, 1);
+	for (i = 0; i < 10000; i++) {
+		append_ll(deque, &i, sizeof(int));
+	}
+	reverse_ll(deque);
+	check(get_int_val_ll(deque, 0) == 9999, "reversed deque");
+	reverse_ll(deque);
+	long long popped_total = 0;
+	while (get_size_ll(deque) > 1) {
+		int *popped = extract_tail_ll(deque);
+		popped_total += *popped;
+		free(popped);
+	}
+	check(popped_total == 49995000 && get_int_val_ll(deque, 0) == 0, "popping all but one value from the back of the deque");
+	internal_check_ll(deque, 0);
+	free_linked_list(deque);
+	linked_list *flipped = new_linked_list(NULL);
+	set_deque_ll(flipped, 1);
+	set_compare_ll(flipped, compare_int);
+	int flipped_values[] = {5, -1, 41, 3, 7};
+	for (i = 0; i < 5; i++) {
+		append_ll(flipped, &flipped_values[i], sizeof(int));
+	}
+	reverse_ll(flipped);
+	merge_sort_ll(flipped);
+	check(is_sorted_ll(flipped) && get_int_val_ll(flipped, 0) == 41 && get_int_val_ll(flipped, 4) == -1, "merge_sort_ll sorts a reversed deque");
+	reverse_ll(flipped);
+	parallel_merge_sort_ll(flipped, 2);
+	check(is_sorted_ll(flipped) && get_int_val_ll(flipped, 0) == 41, "parallel_merge_sort_ll sorts a reversed deque");
+	reverse_ll(flipped);
+	radix_sort_ll(flipped, int_key_ll);
+	check(is_sorted_ll(flipped) && get_int_val_ll(flipped, 0) == 41, "radix_sort_ll sorts a reversed deque");
+	reverse_ll(flipped);
+	check(natural_merge_sort_ll(flipped) == 1 && get_int_val_ll(flipped, 0) == 41, "natural_merge_sort_ll sorts a reversed deque");
+	reverse_ll(flipped);
+	merge_sort_in_place_ll(flipped);
+	check(is_sorted_ll(flipped) && get_int_val_ll(flipped, 0) == 41, "merge_sort_in_place_ll sorts a reversed deque");
+	internal_check_ll(flipped, 0);
+	free_linked_list(flipped);
+
+	linked_list *batch = new_linked_list(NULL);
+	for (i = 0; i < 10000; i++) {
+		append_ll(batch, &i, sizeof(int));
+	}
+	size_t batch_indexes[1000];
+	for (i = 0; i < 1000; i++) {
+		batch_indexes[i] = ((size_t) i * 7919) % 10000; // Unsorted
+	}
+	check(delete_many_ll(batch, batch_indexes, 1000) == 1000 && get_size_ll(batch) == 9000, "delete_many_ll with unsorted indexes");
+	set_compare_ll(batch, compare_int);
+	int batch_kept = 1;
+	for (i = 0; batch_kept && i < 1000; i++) {
+		temp = (int) batch_indexes[i];
+		batch_kept = !contains_ll(batch, &temp);
+	}
+	check(batch_kept, "delete_many_ll removed the values at the given indexes");
+	temp = get_int_val_ll(batch, 5);
+	size_t three_indexes[] = {5, 0, get_size_ll(batch) - 1, 5};
+	size_t batch_extracted;
+	void **batch_values = extract_many_ll(batch, three_indexes, 4, &batch_extracted);
+	check(batch_extracted == 3 && *(int*) batch_values[0] == 1 && *(int*) batch_values[1] == temp && *(int*) batch_values[2] == 9999
+		&& get_size_ll(batch) == 8997, "extract_many_ll skips repeated indexes and returns values in index order");
+	for (i = 0; i < (int) batch_extracted; i++) {
+		free(batch_values[i]);
+	}
+	free(batch_values);
+	internal_check_ll(batch, 0);
+	free_linked_list(batch);
+
+	int buffer[10000];
+	for (i = 0; i < 10000; i++) {
+		buffer[i] = i;
+	}
+	linked_list *from_buffer = buffer_to_linked_list(buffer, 10000, sizeof(int), NULL);
+	prepend_many_ll(from_buffer, buffer, 1000, sizeof(int));
+	append_many_ll(from_buffer, buffer + 1000, 1000, sizeof(int));
+	check(get_size_ll(from_buffer) == 12000 && get_int_val_ll(from_buffer, 0) == 0 && get_int_val_ll(from_buffer, 1000) == 0
+		&& get_int_val_ll(from_buffer, 11999) == 1999, "buffer list with prepended and appended batches");
+	internal_check_ll(from_buffer, 0);
+	void **copied_values = get_as_array_ll(from_buffer);
+	size_t packed_size;
+	int *packed = get_packed_array_ll(from_buffer, &packed_size);
+	void **viewed = view_as_array_ll(from_buffer);
+	int arrays_match = packed_size == get_size_ll(from_buffer) * sizeof(int);
+	for (size_t j = 0; j < get_size_ll(from_buffer); j++) {
+		arrays_match = arrays_match && packed[j] == *(int*) copied_values[j] && packed[j] == *(int*) viewed[j];
+		free(copied_values[j]);
+	}
+	check(arrays_match, "copied, packed and viewed arrays agree");
+	free(copied_values);
+	free(packed);
+	free(viewed);
+	free_linked_list(from_buffer);
+
+	linked_list *batched_pool = new_linked_list(NULL);
+	linked_list *looped_pool = new_linked_list(NULL);
+	set_pool_ll(batched_pool, sizeof(int), 32);
+	set_pool_ll(looped_pool, sizeof(int), 32);
+	for (i = 0; i < 1000; i += 20) {
+		append_many_ll(batched_pool, buffer + i, 20, sizeof(int));
+	}
+	for (i = 0; i < 1000; i++) {
+		append_ll(looped_pool, &buffer[i], sizeof(int));
+	}
+	check(same_ints(batched_pool, looped_pool) && get_memory_stats_ll(batched_pool).allocations <= get_memory_stats_ll(looped_pool).allocations,
+		"batched appends into a small slab pool allocate no more than single appends");
+	internal_check_ll(batched_pool, 0);
+	free_linked_list(batched_pool);
+	free_linked_list(looped_pool);
+
+	linked_list *splice_src = new_linked_list(NULL);
+	linked_list *splice_dst = new_linked_list(NULL);
+	for (i = 0; i < 10000; i++) {
+		append_ll(splice_src, &i, sizeof(int));
+	}
+	check(splice_ll(splice_dst, 0, splice_src, 2500, 7499) == 5000, "splice_ll moves 5000 values");
+	linked_list *split = split_at_ll(splice_src, 1250);
+	combine_ll(splice_dst, split);
+	check(get_size_ll(splice_src) == 1250 && get_size_ll(splice_dst) == 8750 && get_int_val_ll(splice_dst, 0) == 2500
+		&& get_int_val_ll(splice_dst, 8749) == 9999, "splice, split and combine");
+	internal_check_ll(splice_src, 0);
+	internal_check_ll(splice_dst, 0);
+	free_linked_list(splice_src);
+	free_linked_list(splice_dst);
+
+	linked_list *cursored = new_linked_list(NULL);
+	for (i = 0; i < 10000; i++) {
+		append_ll(cursored, &i, sizeof(int));
+	}
+	ll_cursor cursor = cursor_begin_ll(cursored);
+	int *cursor_val;
+	while ((cursor_val = cursor_next_ll(&cursor)) != NULL) {
+		if (*cursor_val % 2) {
+			cursor_remove_ll(&cursor);
+		}
+	}
+	check(get_size_ll(cursored) == 5000, "cursor removes every odd value");
+	long long pair_total = 0;
+	ll_cursor outer = cursor_begin_ll(cursored);
+	for (i = 0; i < 3 && cursor_next_ll(&outer) != NULL; i++) {
+		ll_cursor inner = cursor_begin_ll(cursored); // Nested cursors do not disturb each other
+		while ((cursor_val = cursor_next_ll(&inner)) != NULL) {
+			pair_total += *cursor_val;
+		}
+		pair_total += *(int*) cursor_peek_ll(&outer);
+	}
+	check(pair_total == 3 * 24995000LL + 2 + 4 + 6, "three nested cursor passes");
+	internal_check_ll(cursored, 0);
+	free_linked_list(cursored);
+
+	unrolled_list *unrolled = new_unrolled_list(sizeof(int), 4, NULL);
+	set_compare_ul(unrolled, compare_int);
+	set_print_ul(unrolled, print_as_int);
+	for (i = 0; i < 8; i++) {
+		append_ul(unrolled, &values[i]);
+	}
+	insert_ul(unrolled, &values[0], 2);
+	insert_ul(unrolled, &values[1], 2);
+	prepend_ul(unrolled, &values[7]);
+	delete_ul(unrolled, 5);
+	delete_ul(unrolled, 5);
+	void *unrolled_extract = extract_ul(unrolled, 3);
+	check(*(int*)unrolled_extract == 2, "extract from unrolled index 3");
+	free(unrolled_extract);
+	reverse_ul(unrolled);
+	int unrolled_expected[] = {8, 7, 6, 5, 1, 2, 1, 8};
+	int unrolled_matches = get_size_ul(unrolled) == 8;
+	for (i = 0; unrolled_matches && i < 8; i++) {
+		unrolled_matches = *(int*) get_data_ul(unrolled, i) == unrolled_expected[i];
+	}
+	check(unrolled_matches, "unrolled list after inserts, deletes, an extract and reversing is 8 7 6 5 1 2 1 8");
+	unrolled_list *unrolled_slice = slice_unrolled_list(unrolled, 2, 5, NULL);
+	combine_ul(unrolled, unrolled_slice);
+	merge_sort_ul(unrolled);
+	check(is_sorted_ul(unrolled) && get_index_ul(unrolled, &values[4], 2) == 6, "unrolled list combined with its 2 - 5 slice and sorted");
+	print_ul(unrolled);
+	free_unrolled_list(unrolled);
+
+	compressed_list *ids = new_compressed_list(0, NULL);
+	for (i = 0; i < 100000; i++) {
+		append_cl(ids, i * 3 + (i % 7));
+	}
+	check(get_memory_cl(ids) < 100000 * sizeof(int), "compressed list is smaller than an int array");
+	check(get_int_val_cl(ids, 0) == 0 && get_int_val_cl(ids, 99999) == 300001 && get_int_val_cl(ids, 12345) == 37039,
+		"compressed list gets");
+	check(get_index_cl(ids, 37039, 1) == 12345, "compressed list index of 37039");
+	int tail_ids_match = 1;
+	for (i = 99000; i < 100000; i++) { // The last blocks, the tail block included
+		tail_ids_match = tail_ids_match && get_int_val_cl(ids, i) == i * 3 + (i % 7);
+	}
+	check(tail_ids_match, "compressed list indexes in the last blocks");
+	merge_sort_cl(ids);
+	iter_cl(ids);
+	temp = *(int*)iter_cl(NULL);
+	check(temp == 300001 && *(int*)iter_cl(NULL) == 299997, "sorted compressed list starts with 300001, 299997");
+	cl_cursor outer_ids = cursor_begin_cl(ids);
+	cl_cursor inner_ids = cursor_begin_cl(ids);
+	cursor_next_cl(&inner_ids);
+	int *outer_id = cursor_next_cl(&outer_ids);
+	check(*outer_id == 300001 && *cursor_next_cl(&inner_ids) == 299997, "two compressed list cursors at once");
+	empty_cl(ids);
+	check(get_int_val_cl(ids, 0) == 0, "empty compressed list index 0");
+	free_compressed_list(ids);
+
+	const char *tokens[] = {"GET", "POST", "GET", "/index.html", "200", "GET", "404", "/index.html", "PUT", "200"};
+	char token[32];
+	linked_list *token_list = new_string_linked_list(1, NULL);
+	for (i = 0; i < 10000; i++) {
+		if (i % 100 == 0) {
+			sprintf(token, "session-%d", i % 5000);
+			append_str_ll(token_list, token);
+		} else {
+			append_str_ll(token_list, tokens[i % 10]);
+		}
+	}
+	merge_sort_ll(token_list);
+	size_t last_token = get_size_ll(token_list) - 1;
+	check(is_sorted_ll(token_list), "interned token list sorts");
+	check(strcmp(get_str_val_ll(token_list, 0), "session-900") == 0 && strcmp(get_str_val_ll(token_list, last_token), "/index.html") == 0
+		&& get_str_len_ll(token_list, last_token) == 11, "first and last sorted tokens");
+	check(get_index_str_ll(token_list, "session-4200", 1) == 24 && get_index_str_ll(token_list, "DELETE", 1) == get_size_ll(token_list),
+		"string index lookups");
+	linked_list *token_slice = slice_linked_list(token_list, 0, 2, NULL);
+	free_linked_list(token_list);
+	linked_list *plain_tokens = new_string_linked_list(0, NULL);
+	append_str_ll(plain_tokens, "200");
+	combine_ll(plain_tokens, token_slice);
+	print_ll(plain_tokens);
+	check(get_index_str_ll(plain_tokens, "session-900", 2) == 2, "second session-900 in a plain string list");
+	free_linked_list(plain_tokens);
+
 	int seperate_test_func(void * a) {
 		int aa = *(int*)a;
 		return (aa == -4) || (aa == 18) || (aa == 6);
@@ -232,5 +819,5 @@ int main() {
 	free_linked_list(tail_slice);
 	free_linked_list(sliced_list);
 	free_linked_list(clone_list);
-	return 0;
+	return failed_checks != 0;
 }